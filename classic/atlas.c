@@ -0,0 +1,337 @@
+/*
+ * Infix Demo — Glyph atlas and batched text quads for the scrollers
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * All glyphs, their outline variants, and the 3D roller looks baked
+ * from those, are rasterized white into a single texture.  Color comes
+ * from the vertices instead of per-glyph SDL_SetTextureColorMod(), so
+ * a whole line of text, in any mix of colors and sizes, is one
+ * SDL_RenderGeometry() call.
+ *
+ * The kerning pairs of the plain font are looked up once here as well,
+ * which keeps FreeType out of the per-frame text layout.
+ *
+ * Rasterizing only needs the fonts, so it can run on a worker thread
+ * during startup, while uploading the finished sheet is one texture
+ * update on the render thread.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "atlas.h"
+
+#define ATLAS_WIDTH   1024
+#define ATLAS_PADDING 1        /* Keep neighbours out of filtered samples */
+#define GLOW_ALPHA    40       /* Of the halo behind roller glyphs */
+
+/* Layer of a baked glyph: a white glyph, stretched over a rect, in some gray and alpha */
+typedef struct {
+	const SDL_Surface *s;
+	float x, y, w, h;
+	float gray, alpha;
+} Layer;
+
+/* Bilinear coverage of glyph surface s at (u, v), zero outside */
+static float coverage(const SDL_Surface *s, float u, float v)
+{
+	int x0 = (int)floorf(u), y0 = (int)floorf(v);
+	float fx = u - x0, fy = v - y0;
+	float sum = 0.0f;
+
+	for (int j = 0; j < 2; j++) {
+		int y = y0 + j;
+
+		if (y < 0 || y >= s->h)
+			continue;
+		for (int i = 0; i < 2; i++) {
+			int x = x0 + i;
+			const Uint32 *row;
+
+			if (x < 0 || x >= s->w)
+				continue;
+			row = (const Uint32 *)((const Uint8 *)s->pixels + y * s->pitch);
+			sum += (row[x] >> 24) * (i ? fx : 1 - fx) * (j ? fy : 1 - fy);
+		}
+	}
+
+	return sum / 255.0f;
+}
+
+/*
+ * Composite layers, back to front, into one white-to-black glyph that
+ * the renderer tints with the vertex color like any other.  Gray is
+ * stored unpremultiplied, so a black outline stays black when tinted.
+ */
+static SDL_Surface *bake(int w, int h, const Layer *layer, int num)
+{
+	SDL_Surface *out = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+
+	if (!out)
+		return NULL;
+
+	for (int y = 0; y < h; y++) {
+		Uint32 *row = (Uint32 *)((Uint8 *)out->pixels + y * out->pitch);
+
+		for (int x = 0; x < w; x++) {
+			float c = 0.0f, a = 0.0f;
+
+			for (int l = 0; l < num; l++) {
+				const Layer *ly = &layer[l];
+				float u = (x + 0.5f - ly->x) * ly->s->w / ly->w - 0.5f;
+				float v = (y + 0.5f - ly->y) * ly->s->h / ly->h - 0.5f;
+				float la = coverage(ly->s, u, v) * ly->alpha;
+
+				c = ly->gray * la + c * (1.0f - la);
+				a = la + a * (1.0f - la);
+			}
+
+			Uint32 g = a > 0.0f ? (Uint32)(255.0f * c / a + 0.5f) : 0;
+			Uint32 al = (Uint32)(255.0f * a + 0.5f);
+			row[x] = al << 24 | g << 16 | g << 8 | g;
+		}
+	}
+
+	return out;
+}
+
+/*
+ * The 3D roller draws a glyph over a faint halo, optionally with the
+ * outline font behind it, shifted up-left by a pixel and squeezed to
+ * the glyph size as a shadow or a thicker stroke.  Bake each of those
+ * looks into a single glyph, ATLAS_GLOW pixels larger on each side.
+ */
+static void bake_roller(SDL_Surface *surf[GLYPH_VARIANTS][256], int ch)
+{
+	const SDL_Surface *plain = surf[GLYPH_PLAIN][ch];
+	const SDL_Surface *outline = surf[GLYPH_OUTLINE][ch];
+	int w, h, m = ATLAS_GLOW;
+
+	if (!plain)
+		return;
+	w = plain->w + 2 * m;
+	h = plain->h + 2 * m;
+
+	Layer glow  = { plain, 0, 0, w, h, 1.0f, GLOW_ALPHA / 255.0f };
+	Layer glyph = { plain, m, m, plain->w, plain->h, 1.0f, 1.0f };
+	Layer layer[3] = { glow, glyph };
+
+	surf[GLYPH_GLOW][ch] = bake(w, h, layer, 2);
+
+	if (!outline)
+		return;
+
+	Layer stroke = { outline, m - 1, m - 1, plain->w, plain->h, 0.0f, 1.0f };
+	layer[1] = stroke;
+	layer[2] = glyph;
+	surf[GLYPH_GLOW_SHADOW][ch] = bake(w, h, layer, 3);
+
+	layer[1].gray = 1.0f;
+	surf[GLYPH_GLOW_OUTLINE][ch] = bake(w, h, layer, 3);
+}
+
+GlyphAtlas *atlas_rasterize(TTF_Font *font, TTF_Font *outline)
+{
+	SDL_Surface *surf[GLYPH_VARIANTS][256] = { 0 };
+	SDL_Color white = {255, 255, 255, 255};
+	TTF_Font *fonts[] = { font, outline };
+	SDL_Surface *sheet = NULL;
+	GlyphAtlas *atlas;
+	int x = ATLAS_PADDING, y = ATLAS_PADDING, row_h = 0;
+
+	atlas = calloc(1, sizeof(*atlas));
+	if (!atlas)
+		return NULL;
+
+	/* Rasterize glyphs from both fonts, then bake the roller looks from them */
+	for (int v = GLYPH_PLAIN; v <= GLYPH_OUTLINE; v++) {
+		if (!fonts[v])
+			continue;
+
+		for (int ch = ATLAS_FIRST; ch <= ATLAS_LAST; ch++) {
+			char buffer[2] = { (char)ch, '\0' };
+			SDL_Surface *s;
+
+			s = TTF_RenderText_Blended(fonts[v], buffer, white);
+			if (s && s->format->format != SDL_PIXELFORMAT_ARGB8888) {
+				SDL_Surface *conv = SDL_ConvertSurfaceFormat(s, SDL_PIXELFORMAT_ARGB8888, 0);
+
+				SDL_FreeSurface(s);
+				s = conv;
+			}
+			surf[v][ch] = s;
+		}
+	}
+	for (int ch = ATLAS_FIRST; ch <= ATLAS_LAST; ch++)
+		bake_roller(surf, ch);
+
+	/* Shelf-pack, left to right, top to bottom */
+	for (int v = 0; v < GLYPH_VARIANTS; v++) {
+		for (int ch = ATLAS_FIRST; ch <= ATLAS_LAST; ch++) {
+			AtlasGlyph *g = &atlas->glyph[v][ch];
+			SDL_Surface *s = surf[v][ch];
+			int minx, maxx, miny, maxy, advance;
+
+			if (!s)
+				continue;
+
+			if (x + s->w + ATLAS_PADDING > ATLAS_WIDTH) {
+				x = ATLAS_PADDING;
+				y += row_h + ATLAS_PADDING;
+				row_h = 0;
+			}
+
+			/* Baked variants advance like the plain glyph */
+			if (TTF_GlyphMetrics(fonts[v == GLYPH_OUTLINE], ch, &minx, &maxx, &miny, &maxy, &advance) == 0)
+				g->adv = advance;
+			else
+				g->adv = surf[GLYPH_PLAIN][ch] ? surf[GLYPH_PLAIN][ch]->w : s->w;
+
+			g->src.x = x;
+			g->src.y = y;
+			g->src.w = s->w;
+			g->src.h = s->h;
+			g->valid = 1;
+
+			x += s->w + ATLAS_PADDING;
+			if (s->h > row_h)
+				row_h = s->h;
+		}
+	}
+
+#if SDL_TTF_VERSION_ATLEAST(2,0,18)
+	for (int prev = ATLAS_FIRST; prev <= ATLAS_LAST; prev++) {
+		for (int ch = ATLAS_FIRST; ch <= ATLAS_LAST; ch++)
+			atlas->kern[prev - ATLAS_FIRST][ch - ATLAS_FIRST] =
+				TTF_GetFontKerningSizeGlyphs(font, prev, ch);
+	}
+#endif
+
+	atlas->w = ATLAS_WIDTH;
+	atlas->h = y + row_h + ATLAS_PADDING;
+
+	sheet = SDL_CreateRGBSurfaceWithFormat(0, atlas->w, atlas->h, 32, SDL_PIXELFORMAT_ARGB8888);
+	if (!sheet)
+		goto fail;
+	SDL_FillRect(sheet, NULL, 0);
+
+	for (int v = 0; v < GLYPH_VARIANTS; v++) {
+		for (int ch = 0; ch < 256; ch++) {
+			SDL_Surface *s = surf[v][ch];
+			SDL_Rect dst;
+
+			if (!s)
+				continue;
+
+			/* Copy coverage as-is, don't blend it onto the empty sheet */
+			dst = atlas->glyph[v][ch].src;
+			SDL_SetSurfaceBlendMode(s, SDL_BLENDMODE_NONE);
+			SDL_BlitSurface(s, NULL, sheet, &dst);
+		}
+	}
+
+	atlas->sheet = sheet;
+	for (int v = 0; v < GLYPH_VARIANTS; v++) {
+		for (int ch = 0; ch < 256; ch++)
+			SDL_FreeSurface(surf[v][ch]);
+	}
+
+	return atlas;
+fail:
+	if (sheet)
+		SDL_FreeSurface(sheet);
+	for (int v = 0; v < GLYPH_VARIANTS; v++) {
+		for (int ch = 0; ch < 256; ch++)
+			SDL_FreeSurface(surf[v][ch]);
+	}
+	atlas_destroy(atlas);
+
+	return NULL;
+}
+
+int atlas_upload(GlyphAtlas *atlas, SDL_Renderer *renderer)
+{
+	atlas->tex = SDL_CreateTextureFromSurface(renderer, atlas->sheet);
+	if (!atlas->tex)
+		return -1;
+	SDL_SetTextureBlendMode(atlas->tex, SDL_BLENDMODE_BLEND);
+
+	SDL_FreeSurface(atlas->sheet);
+	atlas->sheet = NULL;
+
+	return 0;
+}
+
+void atlas_destroy(GlyphAtlas *atlas)
+{
+	if (!atlas)
+		return;
+
+	if (atlas->sheet)
+		SDL_FreeSurface(atlas->sheet);
+	if (atlas->tex)
+		SDL_DestroyTexture(atlas->tex);
+	free(atlas);
+}
+
+void batch_quad(GlyphBatch *batch, const GlyphAtlas *atlas, const AtlasGlyph *g,
+		const SDL_Rect *dst, SDL_Color color)
+{
+	if (batch->quads == batch->cap) {
+		int cap = batch->cap ? batch->cap * 2 : 128;
+		SDL_Vertex *vert = realloc(batch->vert, cap * 4 * sizeof(SDL_Vertex));
+		int *index;
+
+		if (!vert)
+			return;
+		batch->vert = vert;
+
+		index = realloc(batch->index, cap * 6 * sizeof(int));
+		if (!index)
+			return;
+		batch->index = index;
+		batch->cap = cap;
+	}
+
+	float u0 = (float)g->src.x / atlas->w;
+	float v0 = (float)g->src.y / atlas->h;
+	float u1 = (float)(g->src.x + g->src.w) / atlas->w;
+	float v1 = (float)(g->src.y + g->src.h) / atlas->h;
+	float x0 = dst->x, y0 = dst->y;
+	float x1 = dst->x + dst->w, y1 = dst->y + dst->h;
+
+	SDL_Vertex *vert = &batch->vert[batch->quads * 4];
+	vert[0] = (SDL_Vertex){ { x0, y0 }, color, { u0, v0 } };
+	vert[1] = (SDL_Vertex){ { x1, y0 }, color, { u1, v0 } };
+	vert[2] = (SDL_Vertex){ { x1, y1 }, color, { u1, v1 } };
+	vert[3] = (SDL_Vertex){ { x0, y1 }, color, { u0, v1 } };
+
+	int base = batch->quads * 4;
+	int *index = &batch->index[batch->quads * 6];
+	index[0] = base;
+	index[1] = base + 1;
+	index[2] = base + 2;
+	index[3] = base;
+	index[4] = base + 2;
+	index[5] = base + 3;
+
+	batch->quads++;
+}
+
+void batch_draw(GlyphBatch *batch, SDL_Renderer *renderer, SDL_Texture *tex)
+{
+	if (batch->quads > 0)
+		SDL_RenderGeometry(renderer, tex, batch->vert, batch->quads * 4,
+				   batch->index, batch->quads * 6);
+	batch->quads = 0;
+}
+
+void batch_free(GlyphBatch *batch)
+{
+	free(batch->vert);
+	free(batch->index);
+	batch->vert = NULL;
+	batch->index = NULL;
+	batch->quads = batch->cap = 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Infix Demo — Glyph atlas and batched text quads for the scrollers
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+/* Printable ASCII, everything else uses the fallback advance */
+#define ATLAS_FIRST    32
+#define ATLAS_LAST     126
+#define ATLAS_FALLBACK 35
+#define ATLAS_GLYPHS   (ATLAS_LAST - ATLAS_FIRST + 1)
+
+/* Extra pixels on each side of the baked roller glyphs */
+#define ATLAS_GLOW     2
+
+typedef enum {
+	GLYPH_PLAIN,           /* White glyph, tinted per vertex */
+	GLYPH_OUTLINE,         /* White glyph from the outline font */
+	GLYPH_GLOW,            /* Plain glyph over a faint halo */
+	GLYPH_GLOW_SHADOW,     /* ... with a black outline behind it */
+	GLYPH_GLOW_OUTLINE,    /* ... with a white outline behind it */
+	GLYPH_VARIANTS
+} GlyphVariant;
+
+typedef struct {
+	SDL_Rect src;          /* Position and size in the atlas */
+	int      adv;          /* Horizontal advance in pixels */
+	int      valid;
+} AtlasGlyph;
+
+typedef struct {
+	SDL_Surface *sheet;    /* Until uploaded */
+	SDL_Texture *tex;      /* Alpha blended */
+	int          w, h;
+	AtlasGlyph   glyph[GLYPH_VARIANTS][256];
+	Sint16       kern[ATLAS_GLYPHS][ATLAS_GLYPHS]; /* [prev][ch], printable only */
+} GlyphAtlas;
+
+/* Growing vertex/index arrays for one SDL_RenderGeometry call */
+typedef struct {
+	SDL_Vertex *vert;
+	int        *index;
+	int         quads;
+	int         cap;
+} GlyphBatch;
+
+/* Rasterize all printable glyphs, and their outlines if given, on any thread */
+GlyphAtlas *atlas_rasterize(TTF_Font *font, TTF_Font *outline);
+
+/* Turn the rasterized glyphs into textures, on the render thread */
+int         atlas_upload(GlyphAtlas *atlas, SDL_Renderer *renderer);
+void        atlas_destroy(GlyphAtlas *atlas);
+
+static inline const AtlasGlyph *atlas_glyph(const GlyphAtlas *atlas, GlyphVariant variant,
+					    unsigned char ch)
+{
+	return &atlas->glyph[variant][ch];
+}
+
+/* Advance of a character, with the same fallback the scrollers always used */
+static inline int atlas_advance(const GlyphAtlas *atlas, unsigned char ch)
+{
+	const AtlasGlyph *g = &atlas->glyph[GLYPH_PLAIN][ch];
+
+	return g->valid ? g->adv : ATLAS_FALLBACK;
+}
+
+/* Kerning between two characters, from the table built with the atlas */
+static inline int atlas_kerning(const GlyphAtlas *atlas, unsigned char prev, unsigned char ch)
+{
+	if (prev < ATLAS_FIRST || prev > ATLAS_LAST || ch < ATLAS_FIRST || ch > ATLAS_LAST)
+		return 0;
+
+	return atlas->kern[prev - ATLAS_FIRST][ch - ATLAS_FIRST];
+}
+
+/* Queue glyph g stretched over dst, modulated by color, and draw all at once */
+void batch_quad(GlyphBatch *batch, const GlyphAtlas *atlas, const AtlasGlyph *g,
+		const SDL_Rect *dst, SDL_Color color);
+void batch_draw(GlyphBatch *batch, SDL_Renderer *renderer, SDL_Texture *tex);
+void batch_free(GlyphBatch *batch);
+
+#endif /* ATLAS_H */
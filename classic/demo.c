@@ -9,18 +9,28 @@
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_mixer.h>
+#include <errno.h>
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
 #include <getopt.h>
 #include <stdlib.h>
 
-/* Embedded font, image, and music data */
+#include "atlas.h"
+#include "feed.h"
+#include "fire.h"
+#include "frame.h"
+#include "govern.h"
+#include "kernels.h"
+#include "lut.h"
+#include "pack.h"
+#include "pool.h"
+#include "scroll.h"
+#include "stats.h"
+
+/* Embedded font, images, and music data */
 #include "font_data.h"
-#include "image_data.h"
-#include "logo_data.h"
-#include "infix_data.h"
-#include "wires_data.h"
+#include "assets_data.h"
 
 /* Music data will be included when available */
 #ifdef HAVE_MUSIC
@@ -76,18 +86,6 @@ static inline float fast_cos(float x)
 	return fast_sin(x + PI/2.0f);
 }
 
-typedef enum {
-    SCROLL_NONE,
-    SCROLL_SINE_WAVE,
-    SCROLL_CLASSIC,
-    SCROLL_ROLLER_3D,
-    SCROLL_BOUNCE
-} ScrollStyle;
-
-typedef struct {
-    float x, y, z;
-} Star;
-
 typedef struct {
     float x, y;          /* Current position */
     float vx, vy;        /* Velocity */
@@ -96,173 +94,781 @@ typedef struct {
     float wobble_phase;  /* For wobble animation */
 } LogoParticle;
 
+/* One run of covered pixels in a LogoMask row, [x0, x1) */
+typedef struct {
+    Uint16 x0, x1;
+} MaskSpan;
+
+/* Run-length coverage mask of a logo at its on-screen size */
+typedef struct {
+    int w, h;
+    int *row;            /* h + 1 offsets into span[], row y is row[y]..row[y + 1] */
+    MaskSpan *span;
+} LogoMask;
+
+/* Images, loaded when the first scene using them starts */
+typedef enum {
+    IMAGE_JACK,
+    IMAGE_LOGO,
+    IMAGE_INFIX,
+    IMAGE_WIRES,
+    NUM_IMAGES
+} ImageId;
+
+typedef struct {
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int refs;               /* Scenes using it, see image_get() */
+} Image;
+
+#define NUM_SCENES STATS_SCENES
+
+/* Quality tiers of -q, cheapest first, see quality[] */
+typedef enum {
+    QUALITY_LOW,
+    QUALITY_MEDIUM,
+    QUALITY_HIGH,
+    QUALITY_ULTRA,
+    NUM_QUALITY
+} Quality;
+
+/* Scene set up by a worker, see scene_prefetch() */
+typedef struct {
+    SDL_Thread *thread;     /* NULL when idle */
+    SDL_atomic_t done;      /* Set by the worker when init has returned */
+    int scene;
+    void *state;
+    int rc;                 /* From init */
+} Prefetch;
+
 typedef struct {
     SDL_Window *window;
     SDL_Renderer *renderer;
     SDL_Texture *texture;
-    SDL_Texture *plasma_texture;
     Uint32 *pixels;
+    SDL_Texture *scaled;    /* Below WIDTH x HEIGHT, see scaled_present() */
     TTF_Font *font;
     TTF_Font *font_outline;
-    SDL_Surface *jack_surface;
-    SDL_Texture *jack_texture;
-    SDL_Surface *logo_surface;
-    SDL_Texture *logo_texture;
-    SDL_Surface *infix_surface;
-    SDL_Texture *infix_texture;
-    SDL_Surface *wires_surface;
-    SDL_Texture *wires_texture;
+    GlyphAtlas *atlas;      /* All scroller glyphs, see atlas_rasterize() */
+    Image image[NUM_IMAGES];
+    void *scene_state[NUM_SCENES];  /* NULL until scene_init(), see scenes[] */
+    Prefetch prefetch;      /* Next scene being set up, see scene_prefetch() */
     int current_scene;
     int current_scene_index;  /* Index into scene_list */
     int fixed_scene;
     float time;
     float global_time;
+    float sim_dt;           /* Simulation time to advance this frame, see frame.h */
+    int sim_steps;          /* ... in this many FRAME_SIM_DT steps */
     float fade_alpha;
     int fading;
     ScrollStyle scroll_style;
-    Star stars[NUM_STARS];
     Uint32 scene_duration;  /* Milliseconds per scene */
     int scene_list[16];     /* Custom scene order */
     int num_scenes;         /* Number of scenes in list */
-    char *scroll_text;      /* Dynamically loaded scroll text */
+    ScrollText *scroll;     /* Scroll text, laid out as it scrolls in */
     /* Scroll control state */
     float scroll_speed;     /* Current scroll speed */
     float scroll_pause_until; /* Global time to pause until */
     Uint8 scroll_color[3];  /* Current scroll color (RGB) */
-    float scroll_offset;    /* Accumulated scroll offset */
+    double scroll_offset;   /* Accumulated scroll offset, in text pixels, see scroll.h */
     float last_frame_time;  /* Time of last frame for delta calculation */
-    int roller_effect;      /* Roller text effect: 0=all, 1=no outline, 2=no outline/glow, 3=color outline */
-    /* Tunnel effect optimization LUTs */
-    float *tunnel_distance; /* Pre-calculated distance from center */
-    float *tunnel_angle;    /* Pre-calculated angle from center */
-    /* Plasma effect optimization */
-    float *plasma_distance; /* Pre-calculated distance for 400x300 plasma */
-    Uint32 *plasma_palette; /* Color palette LUT (256 colors) */
+    int roller_effect;      /* Roller text effect: 0=all, 1=no outline, 2=no outline/glow, 3=color outline, -1=by quality */
+    Quality quality;        /* Best tier, the one used unless adaptive */
+    int adaptive;           /* Step quality and resolution to hold the frame rate */
+    Governor gov[NUM_SCENES];  /* Level of each scene, see scene_quality() */
+    const char *assets_dir; /* Artwork overriding the built-in images, or NULL */
 } DemoContext;
 
+/*
+ * Each scene is a row of callbacks in scenes[] and a state struct of
+ * its own, allocated zeroed by scene_init() when the scene is about to
+ * run.  init loads what the scene needs, it may run on a prefetch
+ * thread so must not touch the renderer, upload then creates textures
+ * on the main thread.  update advances the scene ctx->sim_dt seconds,
+ * render draws it, and destroy releases what init and upload loaded.
+ */
+typedef struct {
+    const char *name;
+    size_t size;            /* Of the state struct */
+    int  (*init)(DemoContext *ctx, void *state);
+    int  (*upload)(DemoContext *ctx, void *state);
+    void (*update)(DemoContext *ctx, void *state);
+    void (*render)(DemoContext *ctx, void *state);
+    void (*destroy)(DemoContext *ctx, void *state);
+    int scalable;           /* Renders to scaled_buf(), see --adaptive */
+} Scene;
+
+/* Images, in ImageId order, the pixel formats are also those in the pack */
+static const struct {
+    const char *name;       /* In the pack, or name.png in --assets DIR */
+    Uint32 format;
+    SDL_BlendMode blend;
+} image_src[NUM_IMAGES] = {
+    { "jack",  SDL_PIXELFORMAT_RGB888,   SDL_BLENDMODE_NONE  },  /* No alpha */
+    { "logo",  SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND },
+    { "infix", SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND },
+    { "wires", SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND },
+};
+
+/* Artwork from --assets DIR, converted to the format of the packed image */
+static SDL_Surface *image_file(const char *dir, ImageId id)
+{
+	SDL_Surface *surface, *converted;
+	char path[512];
+
+	snprintf(path, sizeof(path), "%s/%s.png", dir, image_src[id].name);
+	surface = IMG_Load(path);
+	if (!surface) {
+		fprintf(stderr, "Warning: Failed to load %s, using built-in: %s\n", path, IMG_GetError());
+		return NULL;
+	}
+
+	converted = SDL_ConvertSurfaceFormat(surface, image_src[id].format, 0);
+	SDL_FreeSurface(surface);
+
+	return converted;
+}
+
+/*
+ * Load an image, or take another reference to it, see also
+ * image_upload().  Returns NULL if it could not be loaded, every call
+ * must still be paired with an image_put().
+ */
+static Image *image_get(DemoContext *ctx, ImageId id)
+{
+	Image *img = &ctx->image[id];
+
+	if (img->refs++)
+		return img->surface ? img : NULL;
+
+	if (ctx->assets_dir)
+		img->surface = image_file(ctx->assets_dir, id);
+	if (!img->surface)
+		img->surface = pack_surface(assets_pak, assets_pak_len, image_src[id].name);
+	if (!img->surface) {
+		fprintf(stderr, "Warning: Failed to load %s image: %s\n",
+			image_src[id].name, SDL_GetError());
+		return NULL;
+	}
+
+	return img;
+}
+
+/* Create the texture of a decoded image, on the main thread, NULL on failure */
+static Image *image_upload(DemoContext *ctx, Image *img)
+{
+	ImageId id;
+
+	if (!img || img->texture)
+		return img;
+
+	id = img - ctx->image;
+	img->texture = SDL_CreateTextureFromSurface(ctx->renderer, img->surface);
+	if (!img->texture) {
+		fprintf(stderr, "Warning: Failed to create %s texture: %s\n",
+			image_src[id].name, SDL_GetError());
+		return NULL;
+	}
+	SDL_SetTextureBlendMode(img->texture, image_src[id].blend);
+	/* Use nearest neighbor to prevent edge artifacts from linear filtering */
+	SDL_SetTextureScaleMode(img->texture, SDL_ScaleModeNearest);
+
+	return img;
+}
+
+/* Drop a reference from image_get(), the last one frees the image */
+static void image_put(DemoContext *ctx, ImageId id)
+{
+	Image *img = &ctx->image[id];
+
+	if (!img->refs || --img->refs)
+		return;
+
+	if (img->texture)
+		SDL_DestroyTexture(img->texture);
+	if (img->surface)
+		SDL_FreeSurface(img->surface);
+	img->texture = NULL;
+	img->surface = NULL;
+}
+
+/* Points evenly spread over the unit sphere, on a fibonacci spiral */
+static void sphere_points(float (*point)[3], int n)
+{
+	float phi = (1.0f + sqrtf(5.0f)) / 2.0f;  /* Golden ratio */
+
+	for (int i = 0; i < n; i++) {
+		float t = (float)i / n;
+		float inc = acosf(1.0f - 2.0f * t);
+		float azi = 2.0f * PI * i / phi;
+
+		point[i][0] = sinf(inc) * cosf(azi);
+		point[i][1] = sinf(inc) * sinf(azi);
+		point[i][2] = cosf(inc);
+	}
+}
+
+#define PLASMA_W 400
+#define PLASMA_H 300
+
+/* Per-frame plasma parameters shared by all render threads */
+typedef struct {
+	PixelBuf buf;
+	PlasmaParams p;
+} PlasmaJob;
+
+static void plasma_rows(void *arg, int y0, int y1)
+{
+	PlasmaJob *job = arg;
+
+	plasma_kernel(&job->buf, &job->p, y0, y1);
+}
+
+/* The whole screen, for the kernels */
+static PixelBuf screen_buf(DemoContext *ctx)
+{
+	return (PixelBuf){ ctx->pixels, WIDTH, HEIGHT, WIDTH };
+}
+
+/* Resolution steps of --adaptive, in percent of WIDTH x HEIGHT */
+static const int res_percent[] = { 100, 80, 65, 50 };
+#define NUM_RES (int)(sizeof(res_percent) / sizeof(res_percent[0]))
+
+/* What each quality tier draws, the costs that can be left out */
+typedef struct {
+	const char *name;
+	int roller;             /* Roller effect, as with -r */
+	int glow;               /* Layers around each starfield burst particle */
+	int fire;               /* Logos burn, or are just drawn */
+	int lat, lon;           /* Segments of the textured sphere in the starfield */
+	int ball_stars;         /* Points of the 3D star ball */
+} QualityTier;
+
+static const QualityTier quality[NUM_QUALITY] = {
+	{ "low",    2, 0, 0, 10, 15, 100 },
+	{ "medium", 1, 1, 1, 14, 21, 150 },
+	{ "high",   1, 3, 1, 20, 30, 200 },
+	{ "ultra",  0, 3, 1, 28, 42, 300 },
+};
+
+/*
+ * Level 0 of the governor of a scene is the tier set with -q at full
+ * resolution.  Stepping down first drops the tier, one at a time down
+ * to low, then the resolution of scenes that can scale.
+ */
+static const QualityTier *scene_quality(DemoContext *ctx)
+{
+	int tier = (int)ctx->quality - ctx->gov[ctx->current_scene].level;
+
+	return &quality[tier > QUALITY_LOW ? tier : QUALITY_LOW];
+}
+
+static int scene_res(DemoContext *ctx)
+{
+	int res = ctx->gov[ctx->current_scene].level - (int)ctx->quality;
+
+	return res > 0 ? res : 0;
+}
+
+/* The screen buffer at a resolution step, a part of ctx->pixels */
+static PixelBuf res_buf(DemoContext *ctx, int res)
+{
+	int w = WIDTH * res_percent[res] / 100;
+	int h = HEIGHT * res_percent[res] / 100;
+
+	return (PixelBuf){ ctx->pixels, w, h, w };
+}
+
+/*
+ * The screen buffer of a scalable scene, at the resolution its governor
+ * has stepped to.  Screen coordinates scale by buf.w / (float)WIDTH.
+ */
+static PixelBuf scaled_buf(DemoContext *ctx)
+{
+	return res_buf(ctx, scene_res(ctx));
+}
+
+/* Stretch a frame from scaled_buf() over the screen */
+static void scaled_present(DemoContext *ctx, const PixelBuf *buf)
+{
+	SDL_Rect rect = { 0, 0, buf->w, buf->h };
+	SDL_Texture *tex = ctx->texture;
+
+	if (buf->w != WIDTH || buf->h != HEIGHT) {
+		int w = 0, h = 0;
+
+		/* Reallocated on every step, only one size is in use at a time */
+		if (ctx->scaled)
+			SDL_QueryTexture(ctx->scaled, NULL, NULL, &w, &h);
+		if (w != buf->w || h != buf->h) {
+			if (ctx->scaled)
+				SDL_DestroyTexture(ctx->scaled);
+			ctx->scaled = SDL_CreateTexture(ctx->renderer, SDL_PIXELFORMAT_ARGB8888,
+							SDL_TEXTUREACCESS_STREAMING, buf->w, buf->h);
+		}
+
+		if (ctx->scaled) {
+			SDL_SetTextureScaleMode(ctx->scaled, SDL_ScaleModeLinear);
+			tex = ctx->scaled;
+		} else {
+			/* Show this frame from a corner of the full size texture */
+			fprintf(stderr, "Warning: Failed to create scaled texture, "
+				"keeping full resolution: %s\n", SDL_GetError());
+			for (int i = 0; i < NUM_SCENES; i++) {
+				Governor *g = &ctx->gov[i];
+
+				g->num = ctx->quality + 1;
+				if (g->level >= g->num)
+					g->level = g->num - 1;
+			}
+		}
+	}
+
+	SDL_UpdateTexture(tex, &rect, buf->pixels, buf->stride * sizeof(Uint32));
+	SDL_RenderClear(ctx->renderer);
+	SDL_RenderCopy(ctx->renderer, tex, &rect, NULL);
+}
+
+typedef struct {
+	SDL_Texture *texture;   /* PLASMA_W x PLASMA_H, scaled up to the screen */
+	float *distance;        /* Pre-calculated distance from the center */
+	Uint32 *palette;        /* Color palette LUT (256 colors) */
+	float sinx[PLASMA_W * 2];
+	float siny[PLASMA_H * 2];
+} PlasmaState;
+
+static int plasma_init(DemoContext *ctx, void *state)
+{
+	PlasmaState *s = state;
+
+	(void)ctx;
+	s->distance = malloc(PLASMA_W * PLASMA_H * sizeof(float));
+	s->palette = malloc(256 * sizeof(Uint32));
+	if (!s->distance || !s->palette)
+		return -1;
+
+	/* Pre-calculate distances and a 256 color palette for plasma */
+	plasma_tables(s->distance, s->palette, PLASMA_W, PLASMA_H);
+
+	return 0;
+}
+
+static int plasma_upload(DemoContext *ctx, void *state)
+{
+	PlasmaState *s = state;
+
+	/* Lower resolution for performance, smoothly scaled up */
+	s->texture = SDL_CreateTexture(ctx->renderer, SDL_PIXELFORMAT_ARGB8888,
+				       SDL_TEXTUREACCESS_STREAMING, PLASMA_W, PLASMA_H);
+	if (!s->texture)
+		return -1;
+	SDL_SetTextureScaleMode(s->texture, SDL_ScaleModeLinear);
+
+	return 0;
+}
+
+static void plasma_destroy(DemoContext *ctx, void *state)
+{
+	PlasmaState *s = state;
+
+	(void)ctx;
+	if (s->texture)
+		SDL_DestroyTexture(s->texture);
+	free(s->distance);
+	free(s->palette);
+}
+
 /* Plasma effect - optimized with lower resolution and LUT */
-void render_plasma(DemoContext *ctx)
+static void render_plasma(DemoContext *ctx, void *state)
 {
-	#define PLASMA_W 400
-	#define PLASMA_H 300
+	PlasmaState *s = state;
 
 	/* Use global_time so plasma doesn't reset every scene */
 	float t = ctx->global_time * 0.8;
 
-	/* Add drift to the plasma with slow-moving offsets */
-	float drift_x = sin(ctx->global_time * 0.15) * 50.0;
-	float drift_y = cos(ctx->global_time * 0.2) * 40.0;
-
 	/* Precompute sine LUTs for this frame */
-	static float sinx[PLASMA_W * 2];
-	static float siny[PLASMA_H * 2];
-
 	for (int i = 0; i < PLASMA_W * 2; i++)
-		sinx[i] = sin(i * 0.02 + t);
+		s->sinx[i] = sin(i * 0.02 + t);
 	for (int j = 0; j < PLASMA_H * 2; j++)
-		siny[j] = sin(j * 0.02 + t);
+		s->siny[j] = sin(j * 0.02 + t);
+
+	PlasmaJob job = {
+		.buf = { .w = PLASMA_W, .h = PLASMA_H },
+		.p   = {
+			.dist    = s->distance,
+			.palette = s->palette,
+			.sinx    = s->sinx,
+			.siny    = s->siny,
+			.t       = t,
+			/* Add drift to the plasma with slow-moving offsets */
+			.drift_x = sin(ctx->global_time * 0.15) * 50.0,
+			.drift_y = cos(ctx->global_time * 0.2) * 40.0,
+		},
+	};
 
 	/* Lock plasma texture for direct pixel access */
+	int pitch;
+	if (SDL_LockTexture(s->texture, NULL, (void**)&job.buf.pixels, &pitch) < 0)
+		return;
+	job.buf.stride = pitch / 4;
+
+	pool_for(0, PLASMA_H, plasma_rows, &job);
+
+	SDL_UnlockTexture(s->texture);
+
+	SDL_RenderClear(ctx->renderer);
+	SDL_RenderCopy(ctx->renderer, s->texture, NULL, NULL);
+}
+
+/* Saturating add of an RGB contribution to an opaque ARGB pixel */
+static inline Uint32 add_rgb(Uint32 pixel, int r, int g, int b)
+{
+	r += (pixel >> 16) & 0xFF;
+	g += (pixel >> 8) & 0xFF;
+	b += pixel & 0xFF;
+	if (r > 255) r = 255;
+	if (g > 255) g = 255;
+	if (b > 255) b = 255;
+
+	return 0xFF000000 | (r << 16) | (g << 8) | b;
+}
+
+/* Burning logo sizes relative to their source images */
+#define INFIX_FIRE_SCALE 0.40f
+#define WIRES_FIRE_SCALE 0.50f
+
+static void mask_free(LogoMask *mask)
+{
+	if (!mask)
+		return;
+
+	free(mask->row);
+	free(mask->span);
+	free(mask);
+}
+
+/*
+ * Downscale the alpha channel of a logo to w x h and record the runs of
+ * pixels with alpha above 128.  Done once at load time so the fire never
+ * has to look at the surface, or its pixel format, again.
+ */
+static LogoMask *mask_create(SDL_Surface *logo, float scale)
+{
+	LogoMask *mask;
+	int orig_w = logo->w;
+	int orig_h = logo->h;
+	int w = (int)(orig_w * scale);
+	int h = (int)(orig_h * scale);
+	int nspans = 0;
+
+	if (w < 1 || h < 1)
+		return NULL;
+
+	mask = calloc(1, sizeof(*mask));
+	if (!mask)
+		return NULL;
+	mask->w = w;
+	mask->h = h;
+
+	Uint8 *covered = malloc(w);
+	mask->row = malloc((h + 1) * sizeof(int));
+	if (!covered || !mask->row)
+		goto fail;
+
+	/* Two passes, count spans then fill them in */
+	for (int pass = 0; pass < 2; pass++) {
+		if (pass == 1) {
+			mask->span = malloc((nspans ? nspans : 1) * sizeof(MaskSpan));
+			if (!mask->span)
+				goto fail;
+		}
+
+		nspans = 0;
+		for (int y = 0; y < h; y++) {
+			int sample_y = (y * orig_h) / h;
+			if (sample_y >= orig_h) sample_y = orig_h - 1;
+
+			for (int x = 0; x < w; x++) {
+				int sample_x = (x * orig_w) / w;
+				if (sample_x >= orig_w) sample_x = orig_w - 1;
+
+				Uint8 *pixel = (Uint8*)logo->pixels + sample_y * logo->pitch +
+				               sample_x * logo->format->BytesPerPixel;
+				Uint32 color = 0;
+				memcpy(&color, pixel, logo->format->BytesPerPixel);
+				Uint8 r, g, b, a;
+				SDL_GetRGBA(color, logo->format, &r, &g, &b, &a);
+				covered[x] = a > 128;
+			}
+
+			mask->row[y] = nspans;
+			for (int x = 0; x < w; x++) {
+				if (!covered[x])
+					continue;
+
+				int x0 = x;
+				while (x < w && covered[x])
+					x++;
+				if (pass == 1) {
+					mask->span[nspans].x0 = x0;
+					mask->span[nspans].x1 = x;
+				}
+				nspans++;
+			}
+		}
+		mask->row[h] = nspans;
+	}
+
+	free(covered);
+	return mask;
+fail:
+	free(covered);
+	mask_free(mask);
+	return NULL;
+}
+
+/*
+ * Composite a fire buffer, masked by a logo and mapped through the fire
+ * palette, into a (fire_w + 1) x (fire_h + 1) additive texture.  Each
+ * fire pixel covers a 2x2 block and is weighted by its heat, exactly as
+ * an additively blended 2x2 SDL_RenderFillRect would, but the renderer
+ * only sees one SDL_RenderCopy per logo and frame.
+ */
+static void composite_fire(DemoContext *ctx, SDL_Texture **tex, const LogoMask *mask,
+			   const Fire *fire, float palette_shift)
+{
+	int fire_w = mask->w;
+	int fire_h = mask->h;
 	Uint32 *pixels;
 	int pitch;
-	SDL_LockTexture(ctx->plasma_texture, NULL, (void**)&pixels, &pitch);
+
+	if (!*tex) {
+		*tex = SDL_CreateTexture(ctx->renderer, SDL_PIXELFORMAT_ARGB8888,
+					 SDL_TEXTUREACCESS_STREAMING, fire_w + 1, fire_h + 1);
+		if (!*tex)
+			return;
+		SDL_SetTextureBlendMode(*tex, SDL_BLENDMODE_ADD);
+	}
+
+	if (SDL_LockTexture(*tex, NULL, (void **)&pixels, &pitch) < 0)
+		return;
 	int stride = pitch / 4;
 
-	for (int y = 0; y < PLASMA_H; y++) {
-		for (int x = 0; x < PLASMA_W; x++) {
-			int fx = (int)(x + drift_x);
-			int fy = (int)(y + drift_y);
+	for (int y = 0; y < fire_h + 1; y++) {
+		for (int x = 0; x < fire_w + 1; x++)
+			pixels[y * stride + x] = 0xFF000000;
+	}
 
-			/* Clamp to LUT bounds */
-			fx = (fx < 0) ? 0 : ((fx >= PLASMA_W * 2) ? PLASMA_W * 2 - 1 : fx);
-			fy = (fy < 0) ? 0 : ((fy >= PLASMA_H * 2) ? PLASMA_H * 2 - 1 : fy);
+	/* Only render fire where logo has pixels (logo is the window) */
+	for (int y = 0; y < fire_h; y++) {
+		const Uint8 *heat_row = fire_row(fire, y);
 
-			/* Use pre-calculated distance LUT */
-			int idx = y * PLASMA_W + x;
-			float dist = ctx->plasma_distance[idx];
+		for (int i = mask->row[y]; i < mask->row[y + 1]; i++) {
+			for (int x = mask->span[i].x0; x < mask->span[i].x1; x++) {
+				int heat = heat_row[x];
+				if (heat <= 10)  /* Skip very dim pixels */
+					continue;
 
-			/* Pre-calculate sin(dist) term once */
-			float dist_sin = sinf(dist * 0.02f + t * 1.2f);
+				/* Simple fire palette: dark red -> bright red -> orange -> yellow */
+				int shifted_heat = ((int)(heat + palette_shift)) % 200;  /* Cycle through lower range */
+
+				int fire_r, fire_g;
+				if (shifted_heat < 100) {
+					/* Dark red to bright red */
+					fire_r = 128 + (shifted_heat * 127) / 100;
+					fire_g = 0;
+				} else {
+					/* Bright red to yellow */
+					fire_r = 255;
+					fire_g = ((shifted_heat - 100) * 255) / 100;
+				}
 
-			float v = sinx[fx] + siny[fy] +
-			         sinx[(fx + fy) % (PLASMA_W * 2)] +
-			         dist_sin;
+				/* Additive blending scales the color by its alpha, the heat */
+				fire_r = fire_r * heat / 255;
+				fire_g = fire_g * heat / 255;
 
-			/* Use color palette LUT - convert value to palette index */
-			int palette_idx = ((int)(v * 32.0f) & 0xFF);
-			pixels[y * stride + x] = ctx->plasma_palette[palette_idx];
+				Uint32 *p = &pixels[y * stride + x];
+				p[0]          = add_rgb(p[0], fire_r, fire_g, 0);
+				p[1]          = add_rgb(p[1], fire_r, fire_g, 0);
+				p[stride]     = add_rgb(p[stride], fire_r, fire_g, 0);
+				p[stride + 1] = add_rgb(p[stride + 1], fire_r, fire_g, 0);
+			}
 		}
 	}
 
-	SDL_UnlockTexture(ctx->plasma_texture);
+	SDL_UnlockTexture(*tex);
 }
 
-/* Starfield effect */
-void render_starfield(DemoContext *ctx)
+/* A logo on fire, see composite_fire() */
+typedef struct {
+	ImageId id;
+	Image *image;
+	LogoMask *mask;         /* Fire coverage at on-screen size */
+	Fire *fire;             /* Fire simulation, same size as the mask */
+	SDL_Texture *texture;   /* Composited fire overlay */
+} FireLogo;
+
+static void fire_logo_init(DemoContext *ctx, FireLogo *fl, ImageId id, float scale)
 {
-	/* Clear to black */
-	for (int i = 0; i < WIDTH * HEIGHT; i++) {
-		ctx->pixels[i] = 0xFF000000;
+	fl->id = id;
+	fl->image = image_get(ctx, id);
+	if (!fl->image)
+		return;
+
+	fl->mask = mask_create(fl->image->surface, scale);
+	if (fl->mask)
+		fl->fire = fire_create(fl->mask->w, fl->mask->h, 5);
+}
+
+/* Logo texture, and the first fire overlay now rather than in the first frame */
+static void fire_logo_upload(DemoContext *ctx, FireLogo *fl)
+{
+	fl->image = image_upload(ctx, fl->image);
+	if (fl->image && fl->mask && fl->fire)
+		composite_fire(ctx, &fl->texture, fl->mask, fl->fire, 0.0f);
+}
+
+static void fire_logo_destroy(DemoContext *ctx, FireLogo *fl)
+{
+	if (fl->texture)
+		SDL_DestroyTexture(fl->texture);
+	fire_destroy(fl->fire);
+	mask_free(fl->mask);
+	image_put(ctx, fl->id);
+}
+
+/* Burning logo with its upper left corner at (x, y) */
+static void render_fire_logo(DemoContext *ctx, FireLogo *fl, int x, int y)
+{
+	if (!fl->image || !fl->mask || !fl->fire)
+		return;
+
+	int logo_w = fl->mask->w;
+	int logo_h = fl->mask->h;
+
+	/* Just the logo at lower quality, the fire is paused meanwhile */
+	if (!scene_quality(ctx)->fire) {
+		SDL_Rect logo_rect = {x, y, logo_w, logo_h};
+		SDL_RenderCopy(ctx->renderer, fl->image->texture, NULL, &logo_rect);
+		return;
 	}
 
-	/* Update and render stars */
+	/* Update fire every 5th frame to slow it down, see fire_create() */
+	int fire_stepped = fire_update(fl->fire);
+
+	/* Re-composite fire masked by logo only when it has changed */
+	if (fire_stepped || !fl->texture)
+		composite_fire(ctx, &fl->texture, fl->mask, fl->fire, ctx->global_time * 80.0f);
+
+	if (fl->texture) {
+		SDL_Rect fire_rect = {x, y, logo_w + 1, logo_h + 1};
+		SDL_RenderCopy(ctx->renderer, fl->texture, NULL, &fire_rect);
+	}
+
+	/* Draw logo outline on top for definition (with low alpha) */
+	SDL_Rect logo_rect = {x, y, logo_w, logo_h};
+	SDL_SetTextureAlphaMod(fl->image->texture, 100);
+	SDL_RenderCopy(ctx->renderer, fl->image->texture, NULL, &logo_rect);
+	SDL_SetTextureAlphaMod(fl->image->texture, 255);
+}
+
+typedef struct {
+	Star stars[NUM_STARS];
+	float last_burst;       /* global_time of the latest particle burst */
+	int burst_style;
+	Image *jack;            /* Sphere texture */
+	FireLogo infix;         /* Upper left corner */
+	FireLogo wires;         /* Upper right corner */
+} StarfieldState;
+
+static int starfield_init(DemoContext *ctx, void *state)
+{
+	StarfieldState *s = state;
+
+	for (int i = 0; i < NUM_STARS; i++) {
+		s->stars[i].x = (rand() % 2000 - 1000) / 10.0f;
+		s->stars[i].y = (rand() % 2000 - 1000) / 10.0f;
+		s->stars[i].z = (rand() % 10000) / 100.0f;
+	}
+	s->last_burst = -999.0f;
+
+	s->jack = image_get(ctx, IMAGE_JACK);
+	fire_logo_init(ctx, &s->infix, IMAGE_INFIX, INFIX_FIRE_SCALE);
+	fire_logo_init(ctx, &s->wires, IMAGE_WIRES, WIRES_FIRE_SCALE);
+
+	return 0;
+}
+
+static int starfield_upload(DemoContext *ctx, void *state)
+{
+	StarfieldState *s = state;
+
+	s->jack = image_upload(ctx, s->jack);
+	fire_logo_upload(ctx, &s->infix);
+	fire_logo_upload(ctx, &s->wires);
+
+	return 0;
+}
+
+static void starfield_destroy(DemoContext *ctx, void *state)
+{
+	StarfieldState *s = state;
+
+	fire_logo_destroy(ctx, &s->infix);
+	fire_logo_destroy(ctx, &s->wires);
+	image_put(ctx, IMAGE_JACK);
+}
+
+static void starfield_update(DemoContext *ctx, void *state)
+{
+	StarfieldState *s = state;
 	float speed = 100.0f;
+
 	for (int i = 0; i < NUM_STARS; i++) {
 		/* Move star towards camera */
-		ctx->stars[i].z -= speed * 0.016f;
+		s->stars[i].z -= speed * ctx->sim_dt;
 
 		/* Reset star if it passes the camera */
-		if (ctx->stars[i].z <= 0) {
-			ctx->stars[i].x = (rand() % 2000 - 1000) / 10.0f;
-			ctx->stars[i].y = (rand() % 2000 - 1000) / 10.0f;
-			ctx->stars[i].z = 100.0f;
+		if (s->stars[i].z <= 0) {
+			s->stars[i].x = (rand() % 2000 - 1000) / 10.0f;
+			s->stars[i].y = (rand() % 2000 - 1000) / 10.0f;
+			s->stars[i].z = 100.0f;
 		}
+	}
 
-		/* Project 3D to 2D */
-		float k = 128.0f / ctx->stars[i].z;
-		int sx = WIDTH / 2 + (int)(ctx->stars[i].x * k);
-		int sy = HEIGHT / 2 + (int)(ctx->stars[i].y * k);
-
-		/* Calculate brightness based on distance */
-		int brightness = (int)(255 * (1.0f - ctx->stars[i].z / 100.0f));
-		if (brightness < 0) brightness = 0;
-		if (brightness > 255) brightness = 255;
+	/* Trigger new burst every 2.5 seconds */
+	if (ctx->global_time - s->last_burst > 2.5f) {
+		s->last_burst = ctx->global_time;
+		s->burst_style = (s->burst_style + 1) % 3;  /* Cycle through 3 styles */
+	}
+}
 
-		/* Draw star */
-		if (sx >= 0 && sx < WIDTH && sy >= 0 && sy < HEIGHT) {
-			Uint32 color = 0xFF000000 | (brightness << 16) | (brightness << 8) | brightness;
-			ctx->pixels[sy * WIDTH + sx] = color;
+/* Starfield effect */
+static void render_starfield(DemoContext *ctx, void *state)
+{
+	StarfieldState *s = state;
+	const QualityTier *q = scene_quality(ctx);
 
-			/* Draw larger stars for closer ones */
-			if (ctx->stars[i].z < 20.0f && sx > 0 && sy > 0 && sx < WIDTH - 1 && sy < HEIGHT - 1) {
-				ctx->pixels[sy * WIDTH + sx - 1] = color;
-				ctx->pixels[sy * WIDTH + sx + 1] = color;
-				ctx->pixels[(sy - 1) * WIDTH + sx] = color;
-				ctx->pixels[(sy + 1) * WIDTH + sx] = color;
-			}
-		}
+	/* Clear to black */
+	for (int i = 0; i < WIDTH * HEIGHT; i++) {
+		ctx->pixels[i] = 0xFF000000;
 	}
 
+	/* Project and draw the stars */
+	PixelBuf buf = screen_buf(ctx);
+	starfield_kernel(&buf, s->stars, NUM_STARS);
+
 	/* Update texture first for stars */
 	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
 	SDL_RenderClear(ctx->renderer);
 	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
 
 	/* Periodic particle bursts from center (draw before sphere) */
-	static float last_burst_time = -999.0f;
-	static int burst_style = 0;
-	float burst_interval = 2.5f;  /* Burst every 2.5 seconds */
-
 	int cx = WIDTH / 2;
 	int cy = HEIGHT / 2;
 
-	/* Trigger new burst periodically */
-	if (ctx->global_time - last_burst_time > burst_interval) {
-		last_burst_time = ctx->global_time;
-		burst_style = (burst_style + 1) % 3;  /* Cycle through 3 styles */
-	}
-
-	float time_since_burst = ctx->global_time - last_burst_time;
+	float time_since_burst = ctx->global_time - s->last_burst;
 
 	/* Only draw particles during active burst (first 2 seconds) */
 	if (time_since_burst < 2.0f) {
@@ -274,7 +880,7 @@ void render_starfield(DemoContext *ctx)
 			float life = 1.0f - (time_since_burst / 2.0f);
 			if (life < 0.0f) life = 0.0f;
 
-			if (burst_style == 0) {
+			if (s->burst_style == 0) {
 				/* Style 0: Radial explosion (rainbow) */
 				angle = (i / (float)num_particles) * 2 * PI;
 				float speed = 150.0f + (i % 20) * 10.0f;
@@ -286,7 +892,7 @@ void render_starfield(DemoContext *ctx)
 				r = (int)(255 * life * (0.5f + 0.5f * sinf(hue * 2 * PI)));
 				g = (int)(255 * life * (0.5f + 0.5f * sinf(hue * 2 * PI + 2 * PI / 3)));
 				b = (int)(255 * life * (0.5f + 0.5f * sinf(hue * 2 * PI + 4 * PI / 3)));
-			} else if (burst_style == 1) {
+			} else if (s->burst_style == 1) {
 				/* Style 1: Spiral outward (cyan/blue) */
 				angle = (i / (float)num_particles) * 2 * PI;
 				float spiral_speed = 100.0f;
@@ -324,7 +930,7 @@ void render_starfield(DemoContext *ctx)
 			SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_ADD);
 
 			/* Draw glow layers */
-			for (int layer = 3; layer >= 1; layer--) {
+			for (int layer = q->glow; layer >= 1; layer--) {
 				int alpha = (int)((255.0f / (layer + 1)) * life);
 				SDL_SetRenderDrawColor(ctx->renderer, r, g, b, alpha);
 
@@ -340,216 +946,22 @@ void render_starfield(DemoContext *ctx)
 		}
 	}
 
-	/* Burning Infix logo in upper left corner */
-	if (ctx->infix_texture && ctx->infix_surface) {
-		/* Scale logo to 40% */
-		int orig_w = ctx->infix_surface->w;
-		int orig_h = ctx->infix_surface->h;
-		int logo_w = (int)(orig_w * 0.4f);
-		int logo_h = (int)(orig_h * 0.4f);
-		int logo_x = 20;  /* Upper left corner */
-		int logo_y = 20;
-
-		/* Create fire effect buffer matching logo dimensions */
-		static Uint32 fire_buffer[512 * 256];  /* Fire buffer */
-		static int fire_frame_skip = 0;
-		int fire_w = logo_w;
-		int fire_h = logo_h;
-
-		/* Update fire every 5th frame to slow it down */
-		fire_frame_skip++;
-		if (fire_frame_skip >= 5) {
-			fire_frame_skip = 0;
-
-			/* Randomize bottom row each frame to create fire source */
-			for (int x = 0; x < fire_w; x++) {
-				fire_buffer[(fire_h - 1) * fire_w + x] = rand() % 256;
-			}
-
-			/* Fire propagation - lodev.org algorithm */
-			for (int y = 0; y < fire_h - 1; y++) {
-				for (int x = 0; x < fire_w; x++) {
-					/* Calculate indices with wrapping */
-					int y1 = (y + 1) % fire_h;
-					int y2 = (y + 2) % fire_h;
-					int x_left = (x - 1 + fire_w) % fire_w;
-					int x_right = (x + 1) % fire_w;
-
-					/* Average 4 neighboring pixels with exact formula */
-					int sum = fire_buffer[y1 * fire_w + x_left];   /* Below-left */
-					sum += fire_buffer[y1 * fire_w + x];           /* Below */
-					sum += fire_buffer[y1 * fire_w + x_right];     /* Below-right */
-					sum += fire_buffer[y2 * fire_w + x];           /* Two rows below */
-
-					/* Apply decay: (sum * 32) / 129 */
-					fire_buffer[y * fire_w + x] = (sum * 32) / 129;
-				}
-			}
-		}
-
-		/* Render fire masked by logo - only visible through the letters */
-		float palette_shift = ctx->global_time * 80.0f;
-
-		for (int y = 0; y < fire_h; y++) {
-			for (int x = 0; x < fire_w; x++) {
-				/* Sample logo to see if we should show fire here (logo acts as mask) */
-				int sample_x = (x * orig_w) / logo_w;
-				int sample_y = (y * orig_h) / logo_h;
-				if (sample_x >= orig_w) sample_x = orig_w - 1;
-				if (sample_y >= orig_h) sample_y = orig_h - 1;
-
-				Uint8 *pixel = (Uint8*)ctx->infix_surface->pixels + sample_y * ctx->infix_surface->pitch +
-				               sample_x * ctx->infix_surface->format->BytesPerPixel;
-				Uint32 color;
-				memcpy(&color, pixel, ctx->infix_surface->format->BytesPerPixel);
-				Uint8 r, g, b, a;
-				SDL_GetRGBA(color, ctx->infix_surface->format, &r, &g, &b, &a);
-
-				/* Only render fire where logo has pixels (logo is the window) */
-				if (a > 128) {
-					int heat = fire_buffer[y * fire_w + x];
-					if (heat > 10) {  /* Skip very dim pixels */
-						/* Simple fire palette: dark red -> bright red -> orange -> yellow */
-						int shifted_heat = ((int)(heat + palette_shift)) % 200;  /* Cycle through lower range */
-
-						int fire_r, fire_g, fire_b;
-						if (shifted_heat < 100) {
-							/* Dark red to bright red */
-							fire_r = 128 + (shifted_heat * 127) / 100;
-							fire_g = 0;
-							fire_b = 0;
-						} else {
-							/* Bright red to yellow */
-							fire_r = 255;
-							fire_g = ((shifted_heat - 100) * 255) / 100;
-							fire_b = 0;
-						}
-
-						SDL_Rect pixel_rect = {logo_x + x, logo_y + y, 2, 2};
-
-						SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_ADD);
-						SDL_SetRenderDrawColor(ctx->renderer, fire_r, fire_g, fire_b, heat);
-						SDL_RenderFillRect(ctx->renderer, &pixel_rect);
-					}
-				}
-			}
-		}
-
-		/* Optionally draw logo outline on top for definition (with low alpha) */
-		SDL_Rect logo_rect = {logo_x, logo_y, logo_w, logo_h};
-		SDL_SetTextureAlphaMod(ctx->infix_texture, 100);
-		SDL_RenderCopy(ctx->renderer, ctx->infix_texture, NULL, &logo_rect);
-		SDL_SetTextureAlphaMod(ctx->infix_texture, 255);
-	}
-
-	/* Burning Wires logo in upper right corner */
-	if (ctx->wires_texture && ctx->wires_surface) {
-		/* Scale to 50% size for wires logo to fit in window */
-		int orig_w = ctx->wires_surface->w;
-		int orig_h = ctx->wires_surface->h;
-		int logo_w = (int)(orig_w * 0.50f);
-		int logo_h = (int)(orig_h * 0.50f);
-		int logo_x = WIDTH - logo_w - 20;  /* Upper right corner */
-		int logo_y = 20;
-
-		/* Create fire effect buffer matching logo dimensions */
-		static Uint32 wires_fire_buffer[512 * 256];  /* Fire buffer for wires */
-		static int wires_fire_frame_skip = 0;
-		int fire_w = logo_w;
-		int fire_h = logo_h;
-
-		/* Update fire every 5th frame to slow it down */
-		wires_fire_frame_skip++;
-		if (wires_fire_frame_skip >= 5) {
-			wires_fire_frame_skip = 0;
-
-			/* Randomize bottom row each frame to create fire source */
-			for (int x = 0; x < fire_w; x++) {
-				wires_fire_buffer[(fire_h - 1) * fire_w + x] = rand() % 256;
-			}
-
-			/* Fire propagation - lodev.org algorithm */
-			for (int y = 0; y < fire_h - 1; y++) {
-				for (int x = 0; x < fire_w; x++) {
-					/* Calculate indices with wrapping */
-					int y1 = (y + 1) % fire_h;
-					int y2 = (y + 2) % fire_h;
-					int x_left = (x - 1 + fire_w) % fire_w;
-					int x_right = (x + 1) % fire_w;
-
-					/* Average 4 neighboring pixels with exact formula */
-					int sum = wires_fire_buffer[y1 * fire_w + x_left];
-					sum += wires_fire_buffer[y1 * fire_w + x];
-					sum += wires_fire_buffer[y1 * fire_w + x_right];
-					sum += wires_fire_buffer[y2 * fire_w + x];
-
-					/* Apply decay: (sum * 32) / 129 */
-					wires_fire_buffer[y * fire_w + x] = (sum * 32) / 129;
-				}
-			}
-		}
-
-		/* Render fire masked by wires logo */
-		float palette_shift = ctx->global_time * 80.0f;
+	/* Burning Infix logo in upper left corner, scaled to 40%, see INFIX_FIRE_SCALE */
+	render_fire_logo(ctx, &s->infix, 20, 20);
 
-		for (int y = 0; y < fire_h; y++) {
-			for (int x = 0; x < fire_w; x++) {
-				/* Sample logo - scale coordinates back to original dimensions */
-				int sample_x = (x * orig_w) / logo_w;
-				int sample_y = (y * orig_h) / logo_h;
-				if (sample_x >= orig_w) sample_x = orig_w - 1;
-				if (sample_y >= orig_h) sample_y = orig_h - 1;
-
-				Uint8 *pixel = (Uint8*)ctx->wires_surface->pixels + sample_y * ctx->wires_surface->pitch +
-				               sample_x * ctx->wires_surface->format->BytesPerPixel;
-				Uint32 color;
-				memcpy(&color, pixel, ctx->wires_surface->format->BytesPerPixel);
-				Uint8 r, g, b, a;
-				SDL_GetRGBA(color, ctx->wires_surface->format, &r, &g, &b, &a);
-
-				/* Only render fire where logo has pixels */
-				if (a > 128) {
-					int heat = wires_fire_buffer[y * fire_w + x];
-					if (heat > 10) {
-						int shifted_heat = ((int)(heat + palette_shift)) % 200;
-
-						int fire_r, fire_g, fire_b;
-						if (shifted_heat < 100) {
-							fire_r = 128 + (shifted_heat * 127) / 100;
-							fire_g = 0;
-							fire_b = 0;
-						} else {
-							fire_r = 255;
-							fire_g = ((shifted_heat - 100) * 255) / 100;
-							fire_b = 0;
-						}
-
-						SDL_Rect pixel_rect = {logo_x + x, logo_y + y, 2, 2};
-
-						SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_ADD);
-						SDL_SetRenderDrawColor(ctx->renderer, fire_r, fire_g, fire_b, heat);
-						SDL_RenderFillRect(ctx->renderer, &pixel_rect);
-					}
-				}
-			}
-		}
-
-		/* Draw logo outline on top */
-		SDL_Rect logo_rect = {logo_x, logo_y, logo_w, logo_h};
-		SDL_SetTextureAlphaMod(ctx->wires_texture, 100);
-		SDL_RenderCopy(ctx->renderer, ctx->wires_texture, NULL, &logo_rect);
-		SDL_SetTextureAlphaMod(ctx->wires_texture, 255);
-	}
+	/* Burning Wires logo in upper right corner, scaled to 50% to fit in window */
+	if (s->wires.mask)
+		render_fire_logo(ctx, &s->wires, WIDTH - s->wires.mask->w - 20, 20);
 
 	/* Rotating textured sphere in center with Jack image */
-	if (!ctx->jack_texture) return;
+	if (!s->jack) return;
 
 	float sphere_radius = 80.0f;
 	float rotation_y = ctx->global_time * 0.8f;
 
 	/* Create sphere mesh using latitude/longitude grid */
-	int lat_segments = 20;
-	int lon_segments = 30;
+	int lat_segments = q->lat;
+	int lon_segments = q->lon;
 
 	for (int lat = 0; lat < lat_segments; lat++) {
 		for (int lon = 0; lon < lon_segments; lon++) {
@@ -618,7 +1030,7 @@ void render_starfield(DemoContext *ctx)
 
 			/* Render quad as two triangles */
 			int indices[6] = {0, 1, 2, 0, 2, 3};
-			SDL_RenderGeometry(ctx->renderer, ctx->jack_texture, verts, 4, indices, 6);
+			SDL_RenderGeometry(ctx->renderer, s->jack->texture, verts, 4, indices, 6);
 		}
 	}
 }
@@ -640,74 +1052,59 @@ void render_scroller(DemoContext *ctx)
 	ctx->scroll_style = SCROLL_SINE_WAVE;
 }
 
-/* Get pixel from jack surface with bounds checking */
-Uint32 get_jack_pixel(SDL_Surface *surface, int x, int y)
+typedef struct {
+	Image *jack;            /* Face texture */
+} CubeState;
+
+static int cube_init(DemoContext *ctx, void *state)
+{
+	CubeState *s = state;
+
+	s->jack = image_get(ctx, IMAGE_JACK);
+
+	return 0;
+}
+
+static int cube_upload(DemoContext *ctx, void *state)
 {
-	if (!surface || x < 0 || y < 0 || x >= surface->w || y >= surface->h) {
-		return 0xFF000000;
-	}
-	Uint32 *pixels = (Uint32 *)surface->pixels;
-	return pixels[y * surface->w + x];
+	CubeState *s = state;
+
+	s->jack = image_upload(ctx, s->jack);
+
+	return 0;
+}
+
+static void cube_destroy(DemoContext *ctx, void *state)
+{
+	(void)state;
+	image_put(ctx, IMAGE_JACK);
 }
 
 /* Rotating cube with texture mapped faces and copper bars */
-void render_cube(DemoContext *ctx)
+static void render_cube(DemoContext *ctx, void *state)
 {
+	CubeState *s = state;
+
 	/* Clear to black first */
 	for (int i = 0; i < WIDTH * HEIGHT; i++) {
 		ctx->pixels[i] = 0xFF000000;
 	}
 
 	/* Render copper bars */
-	float t = ctx->time;
-	int num_bars = 8;
-	for (int i = 0; i < num_bars; i++) {
-		/* Calculate bar position with sine wave motion */
-		float base_y = (i * HEIGHT / num_bars) + sin(t * 1.5 + i * 0.8) * 40.0;
-		int bar_height = 30;
-
-		/* HSV to RGB for rainbow effect */
-		float hue = (i / (float)num_bars + t * 0.1);
-		hue = hue - floor(hue);  /* Keep in 0-1 range */
-
-		int h_section = (int)(hue * 6);
-		float f = hue * 6 - h_section;
-		int v = 255;
-		int p = 0;
-		int q = (int)(v * (1 - f));
-		int t_val = (int)(v * f);
-
-		int r, g, b;
-		switch (h_section % 6) {
-		case 0: r = v; g = t_val; b = p; break;
-		case 1: r = q; g = v; b = p; break;
-		case 2: r = p; g = v; b = t_val; break;
-		case 3: r = p; g = q; b = v; break;
-		case 4: r = t_val; g = p; b = v; break;
-		default: r = v; g = p; b = q; break;
-		}
-
-		/* Draw bar with gradient */
-		for (int dy = 0; dy < bar_height; dy++) {
-			int y = (int)base_y + dy;
-			if (y >= 0 && y < HEIGHT) {
-				/* Gradient brightness based on position in bar */
-				float brightness = 1.0f - fabsf(dy - bar_height / 2.0f) / (bar_height / 2.0f);
-				brightness = brightness * brightness;  /* Squared for sharper falloff */
-
-				int br = (int)(r * brightness);
-				int bg = (int)(g * brightness);
-				int bb = (int)(b * brightness);
-
-				Uint32 color = 0xFF000000 | (br << 16) | (bg << 8) | bb;
-				for (int x = 0; x < WIDTH; x++) {
-					ctx->pixels[y * WIDTH + x] = color;
-				}
-			}
-		}
-	}
+	PixelBuf buf = screen_buf(ctx);
+	CopperParams copper = {
+		.t         = ctx->time,
+		.num       = 8,
+		.height    = 30,
+		.speed     = 1.5f,
+		.spread    = 0.8f,
+		.amplitude = 40.0f,
+		.hue_speed = 0.1f,
+		.value     = 255,
+	};
+	copper_kernel(&buf, &copper, 0, HEIGHT);
 
-	if (!ctx->jack_surface) {
+	if (!s->jack) {
 		SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
 		SDL_RenderClear(ctx->renderer);
 		SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
@@ -796,11 +1193,6 @@ void render_cube(DemoContext *ctx)
 		}
 	}
 
-	/* Render textured faces using cached texture */
-	if (!ctx->jack_texture) {
-		return;
-	}
-
 	/* Ensure renderer isn't blending our opaque faces */
 	SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_NONE);
 
@@ -830,7 +1222,7 @@ void render_cube(DemoContext *ctx)
 
 			/* Render two triangles to form the quad */
 			int indices[6] = {0, 1, 2, 0, 2, 3};
-			SDL_RenderGeometry(ctx->renderer, ctx->jack_texture, verts, 4, indices, 6);
+			SDL_RenderGeometry(ctx->renderer, s->jack->texture, verts, 4, indices, 6);
 		}
 	}
 
@@ -838,402 +1230,259 @@ void render_cube(DemoContext *ctx)
 	SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_BLEND);
 }
 
-/* Tunnel effect */
-void render_tunnel(DemoContext *ctx)
+/* Rasterize the glyph atlas while the rest of the demo loads */
+static int atlas_worker(void *arg)
 {
-	float t = ctx->time;
-
-	/* Make the tunnel eye move in a semi-elliptic pattern */
-	float eye_x = WIDTH / 2 + cos(t * 0.5) * 120.0;
-	float eye_y = HEIGHT / 2 + sin(t * 0.7) * 60.0;
-
-	for (int y = 0; y < HEIGHT; y++) {
-		for (int x = 0; x < WIDTH; x++) {
-			int idx = y * WIDTH + x;
-
-			float dx = x - eye_x;
-			float dy = y - eye_y;
-
-			float distance = fast_sqrt(dx * dx + dy * dy);
-			if (distance < 1.0f) distance = 1.0f; /* Avoid division by zero */
-
-			/* Use pre-calculated angle from LUT (reduces atan2 calls) */
-			float angle = ctx->tunnel_angle[idx];
-
-			float u = t * 0.5 + 10.0 / distance;
-			float v = angle / PI + t * 0.2;
-
-			int texture_x = (int)(u * 100.0) & 0xFF;
-			int texture_y = (int)(v * 100.0) & 0xFF;
+	DemoContext *ctx = arg;
 
-			int pattern = (texture_x ^ texture_y);
+	ctx->atlas = atlas_rasterize(ctx->font, ctx->font_outline);
 
-			int r = (pattern & 0xFF);
-			int g = ((pattern << 2) & 0xFF);
-			int b = ((pattern << 4) & 0xFF);
-
-			float vignette = 1.0 - (distance / (WIDTH / 2));
-			if (vignette < 0) vignette = 0;
-
-			r = (int)(r * vignette);
-			g = (int)(g * vignette);
-			b = (int)(b * vignette);
-
-			ctx->pixels[idx] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		}
-	}
+	return 0;
 }
 
-/* 3D star ball that bounces */
-void render_star_ball(DemoContext *ctx)
-{
-	/* Generate sphere vertices using fibonacci sphere */
-	#define NUM_BALL_STARS 200
-	#define NUM_BG_STARS 150
-	static float sphere_points[NUM_BALL_STARS][3];
-	static int initialized = 0;
-	static float ball_x = 400.0f;
-	static float ball_y = 300.0f;
-	static float vel_x = 3.0f;
-	static float vel_y = 2.5f;
-	static float squash_x = 1.0f;
-	static float squash_y = 1.0f;
-
-	/* Parallax background stars (3 layers) */
-	typedef struct {
-		float x, y;
-		int layer;  /* 0=far, 1=mid, 2=near */
-		int brightness;
-	} BgStar;
-	static BgStar bg_stars[NUM_BG_STARS];
-	static int bg_initialized = 0;
-
-	if (!initialized) {
-		/* Generate points on sphere using fibonacci spiral */
-		float phi = (1.0f + sqrtf(5.0f)) / 2.0f;  /* Golden ratio */
-		for (int i = 0; i < NUM_BALL_STARS; i++) {
-			float t = (float)i / NUM_BALL_STARS;
-			float inc = acosf(1.0f - 2.0f * t);
-			float azi = 2.0f * PI * i / phi;
-
-			sphere_points[i][0] = sinf(inc) * cosf(azi);
-			sphere_points[i][1] = sinf(inc) * sinf(azi);
-			sphere_points[i][2] = cosf(inc);
-		}
-		initialized = 1;
-	}
-
-	if (!bg_initialized) {
-		/* Initialize background stars with random positions */
-		for (int i = 0; i < NUM_BG_STARS; i++) {
-			bg_stars[i].x = (float)(rand() % WIDTH);
-			bg_stars[i].y = (float)(rand() % HEIGHT);
-			bg_stars[i].layer = i % 3;  /* Distribute across 3 layers */
-			/* Fainter stars for farther layers */
-			bg_stars[i].brightness = (bg_stars[i].layer == 0) ? 60 :
-			                         (bg_stars[i].layer == 1) ? 90 : 120;
-		}
-		bg_initialized = 1;
-	}
+typedef struct {
+	Uint32 *lut[NUM_RES];   /* 2w x 2h packed depth/angle/shade, see tunnel_table() */
+} TunnelState;
 
-	/* Clear to black */
-	for (int i = 0; i < WIDTH * HEIGHT; i++) {
-		ctx->pixels[i] = 0xFF000000;
+static int tunnel_init(DemoContext *ctx, void *state)
+{
+	TunnelState *s = state;
+
+	/*
+	 * Build the LUT of every step the governor may pick here, on the
+	 * prefetch worker, a step down must not stall an already slow
+	 * frame.  Only the full resolution one is required.
+	 */
+	for (int i = 0; i < (ctx->adaptive ? NUM_RES : 1); i++) {
+		PixelBuf buf = res_buf(ctx, i);
+
+		s->lut[i] = malloc(buf.w * 2 * buf.h * 2 * sizeof(Uint32));
+		if (!s->lut[i])
+			break;
+		tunnel_table(s->lut[i], buf.w, buf.h, (float)buf.w / WIDTH);
 	}
 
-	/* Render and update parallax background stars (scrolling opposite to text) */
-	float scroll_speed = 180.0f;  /* Match text scroll speed */
-	for (int i = 0; i < NUM_BG_STARS; i++) {
-		/* Different speeds per layer for parallax effect */
-		float layer_speed = (bg_stars[i].layer == 0) ? 0.2f :
-		                    (bg_stars[i].layer == 1) ? 0.4f : 0.6f;
-
-		/* Scroll left (opposite of text which scrolls left to right when viewing) */
-		bg_stars[i].x += scroll_speed * layer_speed * 0.016f;
-
-		/* Wrap around */
-		if (bg_stars[i].x > WIDTH) {
-			bg_stars[i].x = 0;
-		}
-
-		/* Draw star */
-		int sx = (int)bg_stars[i].x;
-		int sy = (int)bg_stars[i].y;
-		if (sx >= 0 && sx < WIDTH && sy >= 0 && sy < HEIGHT) {
-			int b = bg_stars[i].brightness;
-			Uint32 color = 0xFF000000 | (b << 16) | (b << 8) | b;
-			ctx->pixels[sy * WIDTH + sx] = color;
-		}
-	}
+	return s->lut[0] ? 0 : -1;
+}
 
-	/* Render horizontal raster bars behind the ball */
-	float t = ctx->time;
-	int num_bars = 6;
-	for (int i = 0; i < num_bars; i++) {
-		/* Calculate bar position with sine wave motion */
-		float base_y = (i * HEIGHT / num_bars) + sinf(t * 1.2f + i * 0.9f) * 60.0f;
-		int bar_height = 50;  /* Fatter bars */
-
-		/* HSV to RGB for rainbow effect */
-		float hue = (i / (float)num_bars + t * 0.15f);
-		hue = hue - floorf(hue);  /* Keep in 0-1 range */
-
-		int h_section = (int)(hue * 6);
-		float f = hue * 6 - h_section;
-		int v = 160;  /* Dimmer so ball and stars stand out */
-		int p = 0;
-		int q = (int)(v * (1 - f));
-		int t_val = (int)(v * f);
-
-		int r, g, b;
-		switch (h_section % 6) {
-		case 0: r = v; g = t_val; b = p; break;
-		case 1: r = q; g = v; b = p; break;
-		case 2: r = p; g = v; b = t_val; break;
-		case 3: r = p; g = q; b = v; break;
-		case 4: r = t_val; g = p; b = v; break;
-		default: r = v; g = p; b = q; break;
-		}
+static void tunnel_destroy(DemoContext *ctx, void *state)
+{
+	TunnelState *s = state;
 
-		/* Draw bar with gradient */
-		for (int dy = 0; dy < bar_height; dy++) {
-			int y = (int)base_y + dy;
-			if (y >= 0 && y < HEIGHT - 100) {  /* Leave room for scroll text */
-				/* Gradient brightness based on position in bar */
-				float brightness = 1.0f - fabsf(dy - bar_height / 2.0f) / (bar_height / 2.0f);
-				brightness = brightness * brightness;  /* Squared for sharper falloff */
-
-				int br = (int)(r * brightness);
-				int bg = (int)(g * brightness);
-				int bb = (int)(b * brightness);
-
-				Uint32 color = 0xFF000000 | (br << 16) | (bg << 8) | bb;
-				for (int x = 0; x < WIDTH; x++) {
-					ctx->pixels[y * WIDTH + x] = color;
-				}
-			}
-		}
-	}
+	(void)ctx;
+	for (int i = 0; i < NUM_RES; i++)
+		free(s->lut[i]);
+}
 
-	/* Update ball position with physics */
-	ball_x += vel_x;
-	ball_y += vel_y;
+/* Per-frame tunnel parameters shared by all render threads */
+typedef struct {
+	PixelBuf buf;
+	TunnelParams p;
+} TunnelJob;
 
-	float radius = 80.0f;
-	float squash_intensity = 0.15f;
-	float recovery_speed = 0.2f;
+static void tunnel_rows(void *arg, int y0, int y1)
+{
+	TunnelJob *job = arg;
 
-	/* Bounce off edges with squash */
-	if (ball_x - radius < 0 || ball_x + radius > WIDTH) {
-		vel_x = -vel_x;
-		ball_x = (ball_x < WIDTH / 2) ? radius : WIDTH - radius;
-		squash_x = 1.0f - squash_intensity;  /* Squash horizontally */
-		squash_y = 1.0f + squash_intensity;  /* Stretch vertically */
-	}
-	if (ball_y - radius < 0 || ball_y + radius > HEIGHT) {
-		vel_y = -vel_y;
-		ball_y = (ball_y < HEIGHT / 2) ? radius : HEIGHT - radius;
-		squash_y = 1.0f - squash_intensity;  /* Squash vertically */
-		squash_x = 1.0f + squash_intensity;  /* Stretch horizontally */
-	}
+	tunnel_kernel(&job->buf, &job->p, y0, y1);
+}
 
-	/* Recover to normal shape */
-	squash_x += (1.0f - squash_x) * recovery_speed;
-	squash_y += (1.0f - squash_y) * recovery_speed;
+/* Tunnel effect */
+static void render_tunnel(DemoContext *ctx, void *state)
+{
+	TunnelState *s = state;
+	int res = scene_res(ctx);
+	float t = ctx->time;
 
-	/* Rotation angles */
-	float rot_x = ctx->time * 0.7f;
-	float rot_y = ctx->time * 0.5f;
-	float rot_z = ctx->time * 0.3f;
+	/* Closest step above if out of memory for this one, full is always there */
+	while (res > 0 && !s->lut[res])
+		res--;
 
-	/* Render sphere points */
-	for (int i = 0; i < NUM_BALL_STARS; i++) {
-		float x = sphere_points[i][0] * radius;
-		float y = sphere_points[i][1] * radius;
-		float z = sphere_points[i][2] * radius;
+	PixelBuf buf = res_buf(ctx, res);
+	float scale = (float)buf.w / WIDTH;
+	Uint32 *lut = s->lut[res];
 
-		/* Apply squash and stretch */
-		x *= squash_x;
-		y *= squash_y;
+	/* Make the tunnel eye move in a semi-elliptic pattern */
+	int eye_x = (int)(buf.w / 2 + cos(t * 0.5) * 120.0 * scale);
+	int eye_y = (int)(buf.h / 2 + sin(t * 0.7) * 60.0 * scale);
+
+	/* Keep the screen window inside the LUT on tiny resolutions */
+	if (eye_x < 0) eye_x = 0;
+	if (eye_x > buf.w) eye_x = buf.w;
+	if (eye_y < 0) eye_y = 0;
+	if (eye_y > buf.h) eye_y = buf.h;
+
+	TunnelJob job = {
+		.buf = buf,
+		.p   = {
+			.lut   = lut,
+			.lut_x = buf.w - eye_x,
+			.lut_y = buf.h - eye_y,
+			.du    = (int)(t * 50.0f),   /* u = t * 0.5 scaled by 100 */
+			.dv    = (int)(t * 20.0f),   /* v = t * 0.2 scaled by 100 */
+		},
+	};
 
-		/* Rotate around X axis */
-		float y1 = y * cosf(rot_x) - z * sinf(rot_x);
-		float z1 = y * sinf(rot_x) + z * cosf(rot_x);
-		y = y1;
-		z = z1;
+	pool_for(0, buf.h, tunnel_rows, &job);
 
-		/* Rotate around Y axis */
-		float x1 = x * cosf(rot_y) + z * sinf(rot_y);
-		z1 = -x * sinf(rot_y) + z * cosf(rot_y);
-		x = x1;
-		z = z1;
+	scaled_present(ctx, &buf);
+}
 
-		/* Rotate around Z axis */
-		float x2 = x * cosf(rot_z) - y * sinf(rot_z);
-		float y2 = x * sinf(rot_z) + y * cosf(rot_z);
-		x = x2;
-		y = y2;
+#define NUM_BALL_STARS 300     /* Most, at ultra quality */
+#define NUM_BG_STARS 150
 
-		/* Project to 2D */
-		float depth = 200.0f / (200.0f + z);
-		int sx = (int)(ball_x + x * depth);
-		int sy = (int)(ball_y + y * depth);
+/* Parallax background stars (3 layers) */
+typedef struct {
+	float x, y;
+	int layer;  /* 0=far, 1=mid, 2=near */
+	int brightness;
+} BgStar;
 
-		/* Color based on depth (closer = brighter) */
-		int brightness = (int)(128 + 127 * depth);
-		if (brightness < 0) brightness = 0;
-		if (brightness > 255) brightness = 255;
+typedef struct {
+	float sphere[NUM_BALL_STARS][3];
+	int num_stars;          /* Spread over the sphere, by quality tier */
+	BgStar bg_stars[NUM_BG_STARS];
+	float ball_x, ball_y;
+	float vel_x, vel_y;
+	float squash_x, squash_y;
+} StarBallState;
+
+static int star_ball_init(DemoContext *ctx, void *state)
+{
+	StarBallState *s = state;
 
-		/* Draw star with size based on depth */
-		if (sx >= 1 && sx < WIDTH - 1 && sy >= 1 && sy < HEIGHT - 1) {
-			Uint32 color = 0xFF000000 | (brightness << 16) | (brightness << 8) | brightness;
+	/* Every scene starts at the -q tier, see scene_quality() */
+	s->num_stars = quality[ctx->quality].ball_stars;
+	sphere_points(s->sphere, s->num_stars);
 
-			/* Larger stars for closer points */
-			if (z > 0) {
-				ctx->pixels[sy * WIDTH + sx] = color;
-				ctx->pixels[sy * WIDTH + sx - 1] = color;
-				ctx->pixels[sy * WIDTH + sx + 1] = color;
-				ctx->pixels[(sy - 1) * WIDTH + sx] = color;
-				ctx->pixels[(sy + 1) * WIDTH + sx] = color;
-			} else {
-				ctx->pixels[sy * WIDTH + sx] = color;
-			}
-		}
+	/* Initialize background stars with random positions */
+	for (int i = 0; i < NUM_BG_STARS; i++) {
+		s->bg_stars[i].x = (float)(rand() % WIDTH);
+		s->bg_stars[i].y = (float)(rand() % HEIGHT);
+		s->bg_stars[i].layer = i % 3;  /* Distribute across 3 layers */
+		/* Fainter stars for farther layers */
+		s->bg_stars[i].brightness = (s->bg_stars[i].layer == 0) ? 60 :
+		                            (s->bg_stars[i].layer == 1) ? 90 : 120;
 	}
 
-	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-	SDL_RenderClear(ctx->renderer);
-	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
+	s->ball_x = 400.0f;
+	s->ball_y = 300.0f;
+	s->vel_x = 180.0f;  /* Pixels per second */
+	s->vel_y = 150.0f;
+	s->squash_x = 1.0f;
+	s->squash_y = 1.0f;
+
+	return 0;
 }
 
-/* Rotozoomer effect with texture rotation and zoom */
-void render_rotozoomer(DemoContext *ctx)
+static void star_ball_update(DemoContext *ctx, void *state)
 {
-	/* Clear to black */
-	for (int i = 0; i < WIDTH * HEIGHT; i++) {
-		ctx->pixels[i] = 0xFF000000;
-	}
+	StarBallState *s = state;
 
-	if (!ctx->jack_surface) {
-		SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-		SDL_RenderClear(ctx->renderer);
-		SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
-		return;
-	}
-
-	float t = ctx->time;
+	/* Parallax background stars, scrolling opposite to text */
+	float scroll_speed = 180.0f;  /* Match text scroll speed */
+	for (int i = 0; i < NUM_BG_STARS; i++) {
+		/* Different speeds per layer for parallax effect */
+		float layer_speed = (s->bg_stars[i].layer == 0) ? 0.2f :
+		                    (s->bg_stars[i].layer == 1) ? 0.4f : 0.6f;
 
-	/* Rotation angle and zoom factor */
-	float angle = t * 0.5f;
-	float zoom = 1.5f + sinf(t * 0.7f) * 0.8f;  /* Breathing zoom */
+		/* Scroll left (opposite of text which scrolls left to right when viewing) */
+		s->bg_stars[i].x += scroll_speed * layer_speed * ctx->sim_dt;
 
-	/* Center point with drift */
-	float center_x = WIDTH / 2.0f + sinf(t * 0.3f) * 40.0f;
-	float center_y = HEIGHT / 2.0f + cosf(t * 0.4f) * 30.0f;
+		/* Wrap around */
+		if (s->bg_stars[i].x > WIDTH) {
+			s->bg_stars[i].x = 0;
+		}
+	}
 
-	/* Precompute rotation matrix */
-	float cos_a = cosf(angle);
-	float sin_a = sinf(angle);
+	float radius = 80.0f;
+	float squash_intensity = 0.15f;
+	/* A fifth of the way back per frame at 60 Hz, as a per step rate */
+	float recovery_speed = 1.0f - powf(1.0f - 0.2f, 60.0f * FRAME_SIM_DT);
 
-	int tex_w = ctx->jack_surface->w;
-	int tex_h = ctx->jack_surface->h;
+	/* Update physics, in fixed steps */
+	for (int step = 0; step < ctx->sim_steps; step++) {
+		s->ball_x += s->vel_x * FRAME_SIM_DT;
+		s->ball_y += s->vel_y * FRAME_SIM_DT;
 
-	/* Render rotozoomer */
-	for (int y = 0; y < HEIGHT; y++) {
-		for (int x = 0; x < WIDTH; x++) {
-			/* Translate to center */
-			float dx = (x - center_x) / zoom;
-			float dy = (y - center_y) / zoom;
+		/* Bounce off edges with squash */
+		if (s->ball_x - radius < 0 || s->ball_x + radius > WIDTH) {
+			s->vel_x = -s->vel_x;
+			s->ball_x = (s->ball_x < WIDTH / 2) ? radius : WIDTH - radius;
+			s->squash_x = 1.0f - squash_intensity;  /* Squash horizontally */
+			s->squash_y = 1.0f + squash_intensity;  /* Stretch vertically */
+		}
+		if (s->ball_y - radius < 0 || s->ball_y + radius > HEIGHT) {
+			s->vel_y = -s->vel_y;
+			s->ball_y = (s->ball_y < HEIGHT / 2) ? radius : HEIGHT - radius;
+			s->squash_y = 1.0f - squash_intensity;  /* Squash vertically */
+			s->squash_x = 1.0f + squash_intensity;  /* Stretch horizontally */
+		}
 
-			/* Rotate */
-			float u = dx * cos_a - dy * sin_a;
-			float v = dx * sin_a + dy * cos_a;
+		/* Recover to normal shape */
+		s->squash_x += (1.0f - s->squash_x) * recovery_speed;
+		s->squash_y += (1.0f - s->squash_y) * recovery_speed;
+	}
+}
 
-			/* Translate to texture space and wrap */
-			int tx = ((int)(u + tex_w / 2.0f) % tex_w + tex_w) % tex_w;
-			int ty = ((int)(v + tex_h / 2.0f) % tex_h + tex_h) % tex_h;
+/* 3D star ball that bounces */
+static void render_star_ball(DemoContext *ctx, void *state)
+{
+	StarBallState *s = state;
 
-			/* Sample texture */
-			Uint32 color = get_jack_pixel(ctx->jack_surface, tx, ty);
-			ctx->pixels[y * WIDTH + x] = color;
-		}
+	/* Clear to black */
+	for (int i = 0; i < WIDTH * HEIGHT; i++) {
+		ctx->pixels[i] = 0xFF000000;
 	}
 
-	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-	SDL_RenderClear(ctx->renderer);
-	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
-
-	/* Starball temporarily disabled - hard to see with Jack background */
-	#if 0
-	/* Now render the bouncing starball on top */
-	/* Extract starball rendering code inline */
-	#define NUM_BALL_STARS 200
-	static float sphere_points[NUM_BALL_STARS][3];
-	static int initialized = 0;
-	static float ball_x = 400.0f;
-	static float ball_y = 300.0f;
-	static float vel_x = 3.0f;
-	static float vel_y = 2.5f;
-	static float squash_x = 1.0f;
-	static float squash_y = 1.0f;
-
-	if (!initialized) {
-		/* Generate points on sphere using fibonacci spiral */
-		float phi = (1.0f + sqrtf(5.0f)) / 2.0f;  /* Golden ratio */
-		for (int i = 0; i < NUM_BALL_STARS; i++) {
-			float t = (float)i / NUM_BALL_STARS;
-			float inc = acosf(1.0f - 2.0f * t);
-			float azi = 2.0f * PI * i / phi;
-
-			sphere_points[i][0] = sinf(inc) * cosf(azi);
-			sphere_points[i][1] = sinf(inc) * sinf(azi);
-			sphere_points[i][2] = cosf(inc);
+	/* Parallax background stars */
+	for (int i = 0; i < NUM_BG_STARS; i++) {
+		int sx = (int)s->bg_stars[i].x;
+		int sy = (int)s->bg_stars[i].y;
+		if (sx >= 0 && sx < WIDTH && sy >= 0 && sy < HEIGHT) {
+			int b = s->bg_stars[i].brightness;
+			Uint32 color = 0xFF000000 | (b << 16) | (b << 8) | b;
+			ctx->pixels[sy * WIDTH + sx] = color;
 		}
-		initialized = 1;
 	}
 
-	/* Update ball position with physics */
-	ball_x += vel_x;
-	ball_y += vel_y;
+	/* Render horizontal raster bars behind the ball, fatter and dimmer */
+	PixelBuf buf = screen_buf(ctx);
+	CopperParams copper = {
+		.t         = ctx->time,
+		.num       = 6,
+		.height    = 50,
+		.speed     = 1.2f,
+		.spread    = 0.9f,
+		.amplitude = 60.0f,
+		.hue_speed = 0.15f,
+		.value     = 160,
+	};
+	/* Leave room for scroll text */
+	copper_kernel(&buf, &copper, 0, HEIGHT - 100);
 
 	float radius = 80.0f;
-	float squash_intensity = 0.15f;
-	float recovery_speed = 0.2f;
-
-	/* Bounce off edges with squash */
-	if (ball_x - radius < 0 || ball_x + radius > WIDTH) {
-		vel_x = -vel_x;
-		ball_x = (ball_x < WIDTH / 2) ? radius : WIDTH - radius;
-		squash_x = 1.0f - squash_intensity;
-		squash_y = 1.0f + squash_intensity;
-	}
-	if (ball_y - radius < 0 || ball_y + radius > HEIGHT) {
-		vel_y = -vel_y;
-		ball_y = (ball_y < HEIGHT / 2) ? radius : HEIGHT - radius;
-		squash_y = 1.0f - squash_intensity;
-		squash_x = 1.0f + squash_intensity;
-	}
-
-	/* Recover to normal shape */
-	squash_x += (1.0f - squash_x) * recovery_speed;
-	squash_y += (1.0f - squash_y) * recovery_speed;
 
 	/* Rotation angles */
 	float rot_x = ctx->time * 0.7f;
 	float rot_y = ctx->time * 0.5f;
 	float rot_z = ctx->time * 0.3f;
 
-	/* Render sphere points with additive blending */
-	SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_ADD);
+	/* Fewer points when the governor changes tier, evenly spread all the same */
+	if (s->num_stars != scene_quality(ctx)->ball_stars) {
+		s->num_stars = scene_quality(ctx)->ball_stars;
+		sphere_points(s->sphere, s->num_stars);
+	}
 
-	for (int i = 0; i < NUM_BALL_STARS; i++) {
-		float x = sphere_points[i][0] * radius;
-		float y = sphere_points[i][1] * radius;
-		float z = sphere_points[i][2] * radius;
+	/* Render sphere points */
+	for (int i = 0; i < s->num_stars; i++) {
+		float x = s->sphere[i][0] * radius;
+		float y = s->sphere[i][1] * radius;
+		float z = s->sphere[i][2] * radius;
 
 		/* Apply squash and stretch */
-		x *= squash_x;
-		y *= squash_y;
+		x *= s->squash_x;
+		y *= s->squash_y;
 
 		/* Rotate around X axis */
 		float y1 = y * cosf(rot_x) - z * sinf(rot_x);
@@ -1255,177 +1504,234 @@ void render_rotozoomer(DemoContext *ctx)
 
 		/* Project to 2D */
 		float depth = 200.0f / (200.0f + z);
-		int sx = (int)(ball_x + x * depth);
-		int sy = (int)(ball_y + y * depth);
+		int sx = (int)(s->ball_x + x * depth);
+		int sy = (int)(s->ball_y + y * depth);
 
 		/* Color based on depth (closer = brighter) */
 		int brightness = (int)(128 + 127 * depth);
 		if (brightness < 0) brightness = 0;
 		if (brightness > 255) brightness = 255;
 
-		/* Draw star with glow effect */
+		/* Draw star with size based on depth */
 		if (sx >= 1 && sx < WIDTH - 1 && sy >= 1 && sy < HEIGHT - 1) {
-			/* Larger stars for closer points with glow */
+			Uint32 color = 0xFF000000 | (brightness << 16) | (brightness << 8) | brightness;
+
+			/* Larger stars for closer points */
 			if (z > 0) {
-				SDL_SetRenderDrawColor(ctx->renderer, brightness, brightness, brightness, 255);
-				/* Draw cross pattern for glow */
-				SDL_RenderDrawPoint(ctx->renderer, sx, sy);
-				SDL_RenderDrawPoint(ctx->renderer, sx - 1, sy);
-				SDL_RenderDrawPoint(ctx->renderer, sx + 1, sy);
-				SDL_RenderDrawPoint(ctx->renderer, sx, sy - 1);
-				SDL_RenderDrawPoint(ctx->renderer, sx, sy + 1);
+				ctx->pixels[sy * WIDTH + sx] = color;
+				ctx->pixels[sy * WIDTH + sx - 1] = color;
+				ctx->pixels[sy * WIDTH + sx + 1] = color;
+				ctx->pixels[(sy - 1) * WIDTH + sx] = color;
+				ctx->pixels[(sy + 1) * WIDTH + sx] = color;
 			} else {
-				SDL_SetRenderDrawColor(ctx->renderer, brightness, brightness, brightness, 255);
-				SDL_RenderDrawPoint(ctx->renderer, sx, sy);
+				ctx->pixels[sy * WIDTH + sx] = color;
 			}
 		}
 	}
 
-	SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_BLEND);
-	#endif  /* Starball disabled */
+	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
+	SDL_RenderClear(ctx->renderer);
+	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
 }
 
-/* Checkered floor perspective effect */
-void render_checkered_floor(DemoContext *ctx)
+/* Per-frame rotozoomer parameters shared by all render threads */
+typedef struct {
+	PixelBuf buf;
+	RotozoomParams p;
+} RotozoomJob;
+
+static void rotozoom_rows(void *arg, int y0, int y1)
 {
-	/* Clear to dark blue/purple sky gradient */
-	for (int y = 0; y < HEIGHT; y++) {
-		int r = 0;
-		int g = (int)(20 + (y / (float)HEIGHT) * 30);
-		int b = (int)(40 + (y / (float)HEIGHT) * 60);
-		Uint32 color = 0xFF000000 | (r << 16) | (g << 8) | b;
-		for (int x = 0; x < WIDTH; x++) {
-			ctx->pixels[y * WIDTH + x] = color;
-		}
-	}
+	RotozoomJob *job = arg;
+
+	rotozoom_kernel(&job->buf, &job->p, y0, y1);
+}
+
+typedef struct {
+	Image *jack;            /* Rotated and zoomed texture */
+} RotozoomState;
 
-	/* Floor parameters */
-	float horizon_y = HEIGHT * 0.6f;  /* Horizon line - upper part of screen */
-	float floor_z_far = 50.0f;        /* Far distance */
-	float tile_size = 0.8f;           /* Checkerboard tile size for floor casting */
+static int rotozoom_init(DemoContext *ctx, void *state)
+{
+	RotozoomState *s = state;
 
-	/* Floor casting with proper scrolling (based on lodev.org algorithm) */
+	s->jack = image_get(ctx, IMAGE_JACK);
 
-	/* Camera/player position for scrolling */
-	static float posX = 0.0f;
-	static float posY = 0.0f;
-	posY += 3.0f * 0.016f;  /* Scroll forward - slower to match ball */
+	return 0;
+}
 
-	/* Camera direction (looking straight ahead) */
-	float dirX = 0.0f;
-	float dirY = 1.0f;
+static void rotozoom_destroy(DemoContext *ctx, void *state)
+{
+	(void)state;
+	image_put(ctx, IMAGE_JACK);
+}
 
-	/* Camera plane (for FOV) */
-	float planeX = 0.66f;
-	float planeY = 0.0f;
+/* Rotozoomer effect with texture rotation and zoom */
+static void render_rotozoomer(DemoContext *ctx, void *state)
+{
+	RotozoomState *s = state;
 
-	for (int y = (int)horizon_y; y < HEIGHT; y++) {
-		/* Ray directions for leftmost and rightmost rays */
-		float rayDirX0 = dirX - planeX;
-		float rayDirY0 = dirY - planeY;
-		float rayDirX1 = dirX + planeX;
-		float rayDirY1 = dirY + planeY;
+	if (!s->jack) {
+		/* Clear to black */
+		for (int i = 0; i < WIDTH * HEIGHT; i++) {
+			ctx->pixels[i] = 0xFF000000;
+		}
 
-		/* Calculate row distance (vertical screen position to floor distance) */
-		int p = y - HEIGHT / 2;
+		SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
+		SDL_RenderClear(ctx->renderer);
+		SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
+		return;
+	}
 
-		/* Skip the center horizon line to avoid division by zero */
-		if (p == 0) continue;
+	PixelBuf buf = scaled_buf(ctx);
+	float scale = (float)buf.w / WIDTH;
+	float t = ctx->time;
 
-		float posZ = 0.5f * HEIGHT;
-		float rowDistance = posZ / p;
+	/* Rotation angle and zoom factor */
+	float angle = t * 0.5f;
 
-		/* Calculate floor step (how much texture coords change per screen X pixel) */
-		float floorStepX = rowDistance * (rayDirX1 - rayDirX0) / WIDTH;
-		float floorStepY = rowDistance * (rayDirY1 - rayDirY0) / WIDTH;
+	RotozoomJob job = {
+		.buf = buf,
+		.p   = {
+			.tex        = s->jack->surface->pixels,
+			.tex_stride = s->jack->surface->pitch / 4,
+			.tex_w      = s->jack->surface->w,
+			.tex_h      = s->jack->surface->h,
+			.zoom       = (1.5f + sinf(t * 0.7f) * 0.8f) * scale,  /* Breathing zoom */
+
+			/* Center point with drift */
+			.center_x   = (WIDTH / 2.0f + sinf(t * 0.3f) * 40.0f) * scale,
+			.center_y   = (HEIGHT / 2.0f + cosf(t * 0.4f) * 30.0f) * scale,
+
+			/* Precompute rotation matrix */
+			.cos_a      = cosf(angle),
+			.sin_a      = sinf(angle),
+		},
+	};
 
-		/* Starting floor position for this row */
-		float floorX = posX + rowDistance * rayDirX0;
-		float floorY = posY + rowDistance * rayDirY0;
+	/* Render rotozoomer, every pixel is written so no need to clear */
+	pool_for(0, buf.h, rotozoom_rows, &job);
 
-		for (int x = 0; x < WIDTH; x++) {
-			/* Get checkerboard tile coordinates */
-			/* Add small offset at center to avoid symmetry artifacts */
-			float checkX = floorX;
-			if (x == WIDTH / 2) checkX += 0.01f;
+	scaled_present(ctx, &buf);
+}
 
-			int cellX = (int)floorf(checkX / tile_size);
-			int cellY = (int)floorf(floorY / tile_size);
+/* Per-frame floor casting parameters shared by all render threads */
+typedef struct {
+	PixelBuf buf;
+	FloorParams p;
+} FloorJob;
 
-			/* Checkerboard pattern */
-			int checker = (cellX + cellY) & 1;
+static void floor_rows(void *arg, int y0, int y1)
+{
+	FloorJob *job = arg;
 
-			/* Distance fog */
-			float fog = 1.0f - fminf(rowDistance / floor_z_far, 0.7f);
+	floor_kernel(&job->buf, &job->p, y0, y1);
+}
 
-			int brightness = checker ? (int)(255 * fog) : (int)(50 * fog);
+#define NUM_FLOOR_BALL_STARS 200
+#define FLOOR_HORIZON 0.6f      /* Horizon line, upper part of screen */
 
-			Uint32 color = 0xFF000000 | (brightness << 16) | (brightness << 8) | brightness;
-			ctx->pixels[y * WIDTH + x] = color;
+typedef struct {
+	float pos_x, pos_y;     /* Camera/player position for scrolling */
+	float sphere[NUM_FLOOR_BALL_STARS][3];
+	float ball_x, ball_y;
+	float vel_x, vel_y;     /* Calmer horizontal movement, vertical for bounce */
+} FloorState;
 
-			/* Advance to next pixel */
-			floorX += floorStepX;
-			floorY += floorStepY;
-		}
-	}
+static int floor_init(DemoContext *ctx, void *state)
+{
+	FloorState *s = state;
 
-	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-	SDL_RenderClear(ctx->renderer);
-	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
+	(void)ctx;
+	sphere_points(s->sphere, NUM_FLOOR_BALL_STARS);
+	s->ball_x = 400.0f;
+	s->ball_y = HEIGHT * FLOOR_HORIZON - 100.0f;  /* Well above horizon */
+	s->vel_x = 120.0f;
+	s->vel_y = -300.0f;  /* Initial upward velocity to start bouncing */
 
-	/* Now render the bouncing starball on top */
-	#define NUM_FLOOR_BALL_STARS 200
-	static float sphere_points[NUM_FLOOR_BALL_STARS][3];
-	static int initialized = 0;
-	static float ball_x = 400.0f;
-	static float ball_y = 0.0f;   /* Will be set above horizon on first run */
-	static float vel_x = 2.0f;    /* Calmer horizontal movement */
-	static float vel_y = 0.0f;  /* Vertical velocity for bounce */
-
-	if (!initialized) {
-		/* Generate points on sphere using fibonacci spiral */
-		float phi = (1.0f + sqrtf(5.0f)) / 2.0f;  /* Golden ratio */
-		for (int i = 0; i < NUM_FLOOR_BALL_STARS; i++) {
-			float t = (float)i / NUM_FLOOR_BALL_STARS;
-			float inc = acosf(1.0f - 2.0f * t);
-			float azi = 2.0f * PI * i / phi;
-
-			sphere_points[i][0] = sinf(inc) * cosf(azi);
-			sphere_points[i][1] = sinf(inc) * sinf(azi);
-			sphere_points[i][2] = cosf(inc);
-		}
-		ball_y = horizon_y - 100.0f;  /* Initialize well above horizon */
-		vel_y = -300.0f;  /* Give it initial upward velocity to start bouncing */
-		initialized = 1;
-	}
+	return 0;
+}
 
+static void floor_update(DemoContext *ctx, void *state)
+{
+	FloorState *s = state;
+	float horizon_y = HEIGHT * FLOOR_HORIZON;
 	float radius = 70.0f;         /* Bigger ball */
 	float gravity = 1000.0f;      /* Stronger gravity for livelier bounces */
 	float bounce_damping = 0.85f; /* Less damping = bouncier */
 
-	/* Update physics */
-	vel_y += gravity * 0.016f;  /* Apply gravity */
-	ball_y += vel_y * 0.016f;
-
-	/* Bounce on floor - the floor is at the horizon line */
-	if (ball_y + radius > horizon_y) {
-		ball_y = horizon_y - radius;
-		vel_y = -vel_y * bounce_damping;
-		/* Add a small energy boost to keep it bouncing forever */
-		if (fabsf(vel_y) < 500.0f) {
-			vel_y -= 100.0f;  /* Add upward velocity if bounce is getting weak */
+	s->pos_y += 3.0f * ctx->sim_dt;  /* Scroll forward - slower to match ball */
+
+	/* Update physics, in fixed steps */
+	for (int step = 0; step < ctx->sim_steps; step++) {
+		s->vel_y += gravity * FRAME_SIM_DT;  /* Apply gravity */
+		s->ball_y += s->vel_y * FRAME_SIM_DT;
+
+		/* Bounce on floor - the floor is at the horizon line */
+		if (s->ball_y + radius > horizon_y) {
+			s->ball_y = horizon_y - radius;
+			s->vel_y = -s->vel_y * bounce_damping;
+			/* Add a small energy boost to keep it bouncing forever */
+			if (fabsf(s->vel_y) < 500.0f) {
+				s->vel_y -= 100.0f;  /* Add upward velocity if bounce is getting weak */
+			}
+		}
+
+		/* Move horizontally */
+		s->ball_x += s->vel_x * FRAME_SIM_DT;
+
+		/* Bounce off screen left/right edges */
+		if (s->ball_x - radius < 0 || s->ball_x + radius > WIDTH) {
+			s->vel_x = -s->vel_x;
+			s->ball_x = (s->ball_x < WIDTH / 2) ? radius : WIDTH - radius;
 		}
 	}
+}
 
-	/* Move horizontally */
-	ball_x += vel_x;
+/* Checkered floor perspective effect */
+static void render_checkered_floor(DemoContext *ctx, void *state)
+{
+	FloorState *s = state;
+	PixelBuf buf = scaled_buf(ctx);
+	int horizon_y = (int)(buf.h * FLOOR_HORIZON);
 
-	/* Bounce off screen left/right edges */
-	if (ball_x - radius < 0 || ball_x + radius > WIDTH) {
-		vel_x = -vel_x;
-		ball_x = (ball_x < WIDTH / 2) ? radius : WIDTH - radius;
+	/* Clear to dark blue/purple sky gradient, floor overwrites the rest */
+	for (int y = 0; y < horizon_y; y++) {
+		int r = 0;
+		int g = (int)(20 + (y / (float)buf.h) * 30);
+		int b = (int)(40 + (y / (float)buf.h) * 60);
+		Uint32 color = 0xFF000000 | (r << 16) | (g << 8) | b;
+		for (int x = 0; x < buf.w; x++) {
+			buf.pixels[y * buf.stride + x] = color;
+		}
 	}
 
+	FloorJob job = {
+		.buf = buf,
+		.p   = {
+			.pos_x = s->pos_x,
+			.pos_y = s->pos_y,
+
+			/* Camera direction (looking straight ahead) */
+			.dir_x = 0.0f,
+			.dir_y = 1.0f,
+
+			/* Camera plane (for FOV) */
+			.plane_x = 0.66f,
+			.plane_y = 0.0f,
+
+			.z_far     = 50.0f,  /* Far distance */
+			.tile_size = 0.8f,   /* Checkerboard tile size for floor casting */
+		},
+	};
+
+	pool_for(horizon_y, buf.h, floor_rows, &job);
+
+	scaled_present(ctx, &buf);
+
+	/* Now render the bouncing starball on top */
+	float radius = 70.0f;
+
 	/* Rotation angles - calmer spin */
 	float rot_x = ctx->time * 0.6f;
 	float rot_y = ctx->time * 0.5f;
@@ -1435,9 +1741,9 @@ void render_checkered_floor(DemoContext *ctx)
 	SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_ADD);
 
 	for (int i = 0; i < NUM_FLOOR_BALL_STARS; i++) {
-		float x = sphere_points[i][0] * radius;
-		float y = sphere_points[i][1] * radius;
-		float z = sphere_points[i][2] * radius;
+		float x = s->sphere[i][0] * radius;
+		float y = s->sphere[i][1] * radius;
+		float z = s->sphere[i][2] * radius;
 
 		/* Rotate around X axis */
 		float y1 = y * cosf(rot_x) - z * sinf(rot_x);
@@ -1459,8 +1765,8 @@ void render_checkered_floor(DemoContext *ctx)
 
 		/* Project to 2D */
 		float depth = 200.0f / (200.0f + z);
-		int sx = (int)(ball_x + x * depth);
-		int sy = (int)(ball_y + y * depth);
+		int sx = (int)(s->ball_x + x * depth);
+		int sy = (int)(s->ball_y + y * depth);
 
 		/* Color based on depth */
 		int brightness = (int)(150 + 105 * depth);
@@ -1486,172 +1792,224 @@ void render_checkered_floor(DemoContext *ctx)
 	SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_BLEND);
 }
 
-/* Bouncing logo effect with squash and stretch */
-void render_bouncing_logo(DemoContext *ctx)
+typedef struct {
+	Image *logo;
+	float bounce_x, bounce_y;  /* Upper left corner of the unscaled logo */
+	float squash_x;            /* Horizontal scale factor */
+	float squash_y;            /* Vertical scale factor */
+	int edge;                  /* Edges hit so far this run, see bouncing_logo_update() */
+} BouncingLogoState;
+
+static int bouncing_logo_init(DemoContext *ctx, void *state)
 {
-	static float squash_x = 1.0f;  /* Horizontal scale factor */
-	static float squash_y = 1.0f;  /* Vertical scale factor */
-//	static float prev_x = -1.0f;   /* Previous x position */
-	static float prev_y = -1.0f;   /* Previous y position */
+	BouncingLogoState *s = state;
 
-	/* Clear to dark blue background */
-	for (int i = 0; i < WIDTH * HEIGHT; i++) {
-		ctx->pixels[i] = 0xFF001020;
-	}
+	s->logo = image_get(ctx, IMAGE_LOGO);
+	s->squash_x = 1.0f;
+	s->squash_y = 1.0f;
 
-	if (!ctx->logo_texture) {
-		SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-		SDL_RenderClear(ctx->renderer);
-		SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
+	return 0;
+}
+
+static int bouncing_logo_upload(DemoContext *ctx, void *state)
+{
+	BouncingLogoState *s = state;
+
+	s->logo = image_upload(ctx, s->logo);
+
+	return 0;
+}
+
+static void logo_destroy(DemoContext *ctx, void *state)
+{
+	(void)state;
+	image_put(ctx, IMAGE_LOGO);
+}
+
+static void bouncing_logo_update(DemoContext *ctx, void *state)
+{
+	BouncingLogoState *s = state;
+
+	if (!s->logo)
 		return;
-	}
 
-	/* Get logo dimensions */
-	int logo_w, logo_h;
-	SDL_QueryTexture(ctx->logo_texture, NULL, NULL, &logo_w, &logo_h);
+	int logo_w = s->logo->surface->w;
+	int logo_h = s->logo->surface->h;
 
 	/* Bouncing physics with sine waves for smooth motion */
 	float t = ctx->time;
-	float bounce_x = sin(t * 0.8) * (WIDTH - logo_w) / 2 + (WIDTH - logo_w) / 2;
-	float bounce_y = fabs(sin(t * 1.1)) * (HEIGHT - logo_h - 50) + 25;
+	s->bounce_x = sin(t * 0.8) * (WIDTH - logo_w) / 2 + (WIDTH - logo_w) / 2;
+	s->bounce_y = fabs(sin(t * 1.1)) * (HEIGHT - logo_h - 50) + 25;
 
-	/* Detect edge collisions by checking velocity direction changes */
 	float squash_intensity = 0.1f;  /* How much to squash (0.1 = 10% compression) */
-	float recovery_speed = 0.25f;   /* How fast to recover to normal */
-
-	/* Check horizontal collision (left/right edges) */
-	/*if (prev_x >= 0) {
-		float dx = bounce_x - prev_x;
-		// Detect direction change = wall hit
-		if ((prev_x <= 5 && dx > 0) || (prev_x >= WIDTH - logo_w - 5 && dx < 0)) {
-			squash_x = 1.0f - squash_intensity;  // Squash horizontally
-			squash_y = 1.0f + squash_intensity;  // Stretch vertically
-		}
-	}*/
-
-	/* Check vertical collision (top/bottom edges) */
-	if (prev_y >= 0) {
-		float dy = bounce_y - prev_y;
-		/* Detect direction change = floor/ceiling hit */
-		if ((prev_y <= 30 && dy > 0) || (prev_y >= HEIGHT - logo_h - 30 && dy < 0)) {
-			squash_y = 1.0f - squash_intensity;  /* Squash vertically */
-			squash_x = 1.0f + squash_intensity;  /* Stretch horizontally */
-		}
+	/* A quarter of the way back per frame at 60 Hz, at any frame rate */
+	float recovery_speed = 1.0f - powf(1.0f - 0.25f, ctx->sim_dt * 60.0f);
+
+	/*
+	 * The logo turns at the top edge when t * 1.1 is a multiple of PI,
+	 * and at the bottom half way between, so it has hit another edge
+	 * whenever the count of PI / 2 steps changes.  Found from the time,
+	 * not from frame to frame movement, so no frame rate misses one.
+	 */
+	int edge = (int)(t * 1.1f / (PI / 2));
+	if (edge != s->edge) {
+		s->edge = edge;
+		s->squash_y = 1.0f - squash_intensity;  /* Squash vertically */
+		s->squash_x = 1.0f + squash_intensity;  /* Stretch horizontally */
 	}
 
 	/* Smoothly recover to normal scale */
-	squash_x += (1.0f - squash_x) * recovery_speed;
-	squash_y += (1.0f - squash_y) * recovery_speed;
+	s->squash_x += (1.0f - s->squash_x) * recovery_speed;
+	s->squash_y += (1.0f - s->squash_y) * recovery_speed;
 
 	/* Clamp to prevent overshoot */
-	if (fabs(squash_x - 1.0f) < 0.01f) squash_x = 1.0f;
-	if (fabs(squash_y - 1.0f) < 0.01f) squash_y = 1.0f;
+	if (fabs(s->squash_x - 1.0f) < 0.01f) s->squash_x = 1.0f;
+	if (fabs(s->squash_y - 1.0f) < 0.01f) s->squash_y = 1.0f;
+}
+
+/* Bouncing logo effect with squash and stretch */
+static void render_bouncing_logo(DemoContext *ctx, void *state)
+{
+	BouncingLogoState *s = state;
+
+	/* Clear to dark blue background */
+	for (int i = 0; i < WIDTH * HEIGHT; i++) {
+		ctx->pixels[i] = 0xFF001020;
+	}
+
+	/* Update background texture */
+	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
+	SDL_RenderClear(ctx->renderer);
+	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
 
-	/* Store position for next frame */
-//	prev_x = bounce_x;
-	prev_y = bounce_y;
+	if (!s->logo)
+		return;
+
+	int logo_w = s->logo->surface->w;
+	int logo_h = s->logo->surface->h;
 
 	/* Add some gentle rotation */
-	float rotation = sin(t * 0.5) * 8.0;  /* ±8 degrees */
+	float rotation = sin(ctx->time * 0.5) * 8.0;  /* ±8 degrees */
 
 	/* Apply squash and stretch to dimensions */
-	int scaled_w = (int)(logo_w * squash_x);
-	int scaled_h = (int)(logo_h * squash_y);
+	int scaled_w = (int)(logo_w * s->squash_x);
+	int scaled_h = (int)(logo_h * s->squash_y);
 
 	/* Center the scaled logo at the bounce position */
 	SDL_Rect dest_rect = {
-		(int)(bounce_x + (logo_w - scaled_w) / 2),
-		(int)(bounce_y + (logo_h - scaled_h) / 2),
+		(int)(s->bounce_x + (logo_w - scaled_w) / 2),
+		(int)(s->bounce_y + (logo_h - scaled_h) / 2),
 		scaled_w,
 		scaled_h
 	};
 
-	/* Update background texture */
-	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-	SDL_RenderClear(ctx->renderer);
-	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
-
 	/* Render the rotating, squashing logo */
-	SDL_RenderCopyEx(ctx->renderer, ctx->logo_texture, NULL, &dest_rect,
+	SDL_RenderCopyEx(ctx->renderer, s->logo->texture, NULL, &dest_rect,
 	                 rotation, NULL, SDL_FLIP_NONE);
 }
 
-/* Raining logo effect - logo falls in line by line from bottom to top */
-void render_raining_logo(DemoContext *ctx)
+/* Animation phases of the raining logo */
+#define PHASE_RAIN_IN 0
+#define PHASE_SETTLE 1
+#define PHASE_WOBBLE 2
+#define PHASE_RAIN_OUT 3
+#define PHASE_PAUSE 4
+
+typedef struct {
+	Image *logo;
+	int current_phase;
+	float phase_time;
+} RainingLogoState;
+
+static int raining_logo_init(DemoContext *ctx, void *state)
 {
-	/* Animation phases */
-	#define PHASE_RAIN_IN 0
-	#define PHASE_SETTLE 1
-	#define PHASE_WOBBLE 2
-	#define PHASE_RAIN_OUT 3
-	#define PHASE_PAUSE 4
+	RainingLogoState *s = state;
 
-	static int current_phase = PHASE_RAIN_IN;
-	static float phase_time = 0.0f;
+	s->logo = image_get(ctx, IMAGE_LOGO);
+	s->current_phase = PHASE_RAIN_IN;
 
-	/* Clear to dark blue background */
-	for (int i = 0; i < WIDTH * HEIGHT; i++) {
-		ctx->pixels[i] = 0xFF001020;
-	}
+	return 0;
+}
 
-	if (!ctx->logo_texture) {
-		SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
-		SDL_RenderClear(ctx->renderer);
-		SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
-		return;
-	}
+static int raining_logo_upload(DemoContext *ctx, void *state)
+{
+	RainingLogoState *s = state;
+
+	s->logo = image_upload(ctx, s->logo);
 
-	int logo_w, logo_h;
-	SDL_QueryTexture(ctx->logo_texture, NULL, NULL, &logo_w, &logo_h);
+	return 0;
+}
+
+static void raining_logo_update(DemoContext *ctx, void *state)
+{
+	RainingLogoState *s = state;
 
 	/* Update animation time */
-	float dt = 0.016f;  /* Assume 60 fps */
-	phase_time += dt;
+	s->phase_time += ctx->sim_dt;
 
 	/* Phase transitions */
-	switch (current_phase) {
+	switch (s->current_phase) {
 	case PHASE_RAIN_IN:
-		if (phase_time > 2.0f) {  /* 2 seconds to rain in */
-			current_phase = PHASE_SETTLE;
-			phase_time = 0.0f;
+		if (s->phase_time > 2.0f) {  /* 2 seconds to rain in */
+			s->current_phase = PHASE_SETTLE;
+			s->phase_time = 0.0f;
 		}
 		break;
 	case PHASE_SETTLE:
-		if (phase_time > 0.3f) {  /* 0.3 seconds settling */
-			current_phase = PHASE_WOBBLE;
-			phase_time = 0.0f;
+		if (s->phase_time > 0.3f) {  /* 0.3 seconds settling */
+			s->current_phase = PHASE_WOBBLE;
+			s->phase_time = 0.0f;
 		}
 		break;
 	case PHASE_WOBBLE:
-		if (phase_time > 1.5f) {  /* 1.5 seconds wobbling */
-			current_phase = PHASE_RAIN_OUT;
-			phase_time = 0.0f;
+		if (s->phase_time > 1.5f) {  /* 1.5 seconds wobbling */
+			s->current_phase = PHASE_RAIN_OUT;
+			s->phase_time = 0.0f;
 		}
 		break;
 	case PHASE_RAIN_OUT:
-		if (phase_time > 2.0f) {  /* 2 seconds to rain out */
-			current_phase = PHASE_PAUSE;
-			phase_time = 0.0f;
+		if (s->phase_time > 2.0f) {  /* 2 seconds to rain out */
+			s->current_phase = PHASE_PAUSE;
+			s->phase_time = 0.0f;
 		}
 		break;
 	case PHASE_PAUSE:
-		if (phase_time > 0.5f) {  /* 0.5 second pause */
-			current_phase = PHASE_RAIN_IN;
-			phase_time = 0.0f;
+		if (s->phase_time > 0.5f) {  /* 0.5 second pause */
+			s->current_phase = PHASE_RAIN_IN;
+			s->phase_time = 0.0f;
 		}
 		break;
 	}
+}
+
+/* Raining logo effect - logo falls in line by line from bottom to top */
+static void render_raining_logo(DemoContext *ctx, void *state)
+{
+	RainingLogoState *s = state;
+	float phase_time = s->phase_time;
+
+	/* Clear to dark blue background */
+	for (int i = 0; i < WIDTH * HEIGHT; i++) {
+		ctx->pixels[i] = 0xFF001020;
+	}
 
 	/* Render background */
 	SDL_UpdateTexture(ctx->texture, NULL, ctx->pixels, WIDTH * sizeof(Uint32));
 	SDL_RenderClear(ctx->renderer);
 	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
 
+	if (!s->logo)
+		return;
+
+	SDL_Texture *logo = s->logo->texture;
+	int logo_w = s->logo->surface->w;
+	int logo_h = s->logo->surface->h;
+
 	/* Calculate logo position */
 	int base_x = (WIDTH - logo_w) / 2;
 	int base_y = (HEIGHT - logo_h) / 2;
 
-	if (current_phase == PHASE_RAIN_IN) {
+	if (s->current_phase == PHASE_RAIN_IN) {
 		/* Logo falls down from above screen, bottom lines fall first */
 		/* Each line has a delay based on its position from bottom */
 		for (int line = 0; line < logo_h; line++) {
@@ -1671,17 +2029,17 @@ void render_raining_logo(DemoContext *ctx)
 
 				SDL_Rect src = { 0, src_y, logo_w, 1 };
 				SDL_Rect dst = { base_x, (int)y_pos, logo_w, 1 };
-				SDL_RenderCopy(ctx->renderer, ctx->logo_texture, &src, &dst);
+				SDL_RenderCopy(ctx->renderer, logo, &src, &dst);
 			}
 		}
 	}
-	else if (current_phase == PHASE_SETTLE) {
+	else if (s->current_phase == PHASE_SETTLE) {
 		/* Slight bounce */
 		float settle = exp(-phase_time * 10.0f) * sin(phase_time * 30.0f) * 5.0f;
 		SDL_Rect dst = { base_x, base_y + (int)settle, logo_w, logo_h };
-		SDL_RenderCopy(ctx->renderer, ctx->logo_texture, NULL, &dst);
+		SDL_RenderCopy(ctx->renderer, logo, NULL, &dst);
 	}
-	else if (current_phase == PHASE_WOBBLE) {
+	else if (s->current_phase == PHASE_WOBBLE) {
 		/* Jelly wobble - each line wobbles horizontally with different phase */
 		for (int line = 0; line < logo_h; line++) {
 			/* Sine wave wobble based on line position */
@@ -1693,10 +2051,10 @@ void render_raining_logo(DemoContext *ctx)
 
 			SDL_Rect src = { 0, line, logo_w, 1 };
 			SDL_Rect dst = { base_x + (int)wobble, base_y + line, logo_w, 1 };
-			SDL_RenderCopy(ctx->renderer, ctx->logo_texture, &src, &dst);
+			SDL_RenderCopy(ctx->renderer, logo, &src, &dst);
 		}
 	}
-	else if (current_phase == PHASE_RAIN_OUT) {
+	else if (s->current_phase == PHASE_RAIN_OUT) {
 		/* Rain out through bottom, top lines fall first with gravity */
 		for (int line = 0; line < logo_h; line++) {
 			int src_y = line;
@@ -1714,595 +2072,604 @@ void render_raining_logo(DemoContext *ctx)
 				if (y_pos < HEIGHT) {
 					SDL_Rect src = { 0, src_y, logo_w, 1 };
 					SDL_Rect dst = { base_x, (int)y_pos, logo_w, 1 };
-					SDL_RenderCopy(ctx->renderer, ctx->logo_texture, &src, &dst);
+					SDL_RenderCopy(ctx->renderer, logo, &src, &dst);
 				}
 			} else {
 				/* Not falling yet, render at normal position */
 				SDL_Rect src = { 0, src_y, logo_w, 1 };
 				SDL_Rect dst = { base_x, base_y + src_y, logo_w, 1 };
-				SDL_RenderCopy(ctx->renderer, ctx->logo_texture, &src, &dst);
+				SDL_RenderCopy(ctx->renderer, logo, &src, &dst);
+			}
+		}
+	}
+}
+
+/* Apply control codes the scroll position has reached */
+static void apply_scroll_controls(DemoContext *ctx)
+{
+	/* Codes trigger once they have scrolled this far in from the right edge */
+	double trigger_offset = 500.0;
+	const ControlCode *cc;
+
+	while ((cc = scroll_next_code(ctx->scroll, ctx->scroll_offset - trigger_offset))) {
+		switch (cc->type) {
+		case CC_PAUSE:
+			ctx->scroll_pause_until = ctx->global_time + cc->pause;
+			break;
+
+		case CC_SPEED:
+			ctx->scroll_speed = cc->speed;
+			break;
+
+		case CC_STYLE:
+			ctx->scroll_style = cc->style;
+			break;
+
+		case CC_COLOR:
+			ctx->scroll_color[0] = cc->rgb[0];
+			ctx->scroll_color[1] = cc->rgb[1];
+			ctx->scroll_color[2] = cc->rgb[2];
+			break;
+		}
+	}
+}
+
+/*
+ * The classic scroller line is cached in fixed-width tiles, rendered
+ * from the glyph atlas as they scroll in.  Only a few are resident at
+ * any time, reused least recently drawn first, so texture memory is
+ * bounded by the screen width however long the text is.
+ */
+#define LINE_TILE_W 256
+#define LINE_TILES  8
+
+typedef struct {
+	SDL_Texture *tex;
+	long         index;     /* Covers text pixels index * LINE_TILE_W and on */
+	double       filled;    /* Text was laid out up to here when rendered */
+	Uint32       used;      /* Frame last drawn */
+} LineTile;
+
+static LineTile line_tile[LINE_TILES];
+static SDL_BlendMode line_tile_blend;
+static int line_tiles_ok = -1;
+
+/* Needs render targets, and a custom blend mode, else glyphs are drawn directly */
+static int line_tiles_supported(DemoContext *ctx)
+{
+	if (line_tiles_ok < 0) {
+		/* Tiles hold premultiplied color, glyphs are blended onto transparent */
+		line_tile_blend = SDL_ComposeCustomBlendMode(
+			SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+			SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+		line_tiles_ok = SDL_RenderTargetSupported(ctx->renderer) == SDL_TRUE;
+	}
+
+	return line_tiles_ok;
+}
+
+static void line_tiles_free(void)
+{
+	for (int i = 0; i < LINE_TILES; i++) {
+		if (line_tile[i].tex)
+			SDL_DestroyTexture(line_tile[i].tex);
+		line_tile[i].tex = NULL;
+	}
+}
+
+static void line_tile_render(DemoContext *ctx, LineTile *tile, int h)
+{
+	static GlyphBatch batch;
+	const GlyphAtlas *atlas = ctx->atlas;
+	SDL_Color color = {255, 255, 100, 255};
+	double x0 = tile->index * (double)LINE_TILE_W;
+	double x1 = x0 + LINE_TILE_W;
+
+	for (int c = 0; c < ctx->scroll->num_chunks; c++) {
+		const ScrollChunk *chunk = &ctx->scroll->chunk[c];
+
+		if (chunk->x + chunk->adv[chunk->len] < x0 - 100)
+			continue;
+		if (chunk->x >= x1)
+			break;
+
+		for (int i = scroll_chunk_find(chunk, x0 - 100); i < chunk->len; i++) {
+			const AtlasGlyph *glyph = atlas_glyph(atlas, GLYPH_PLAIN, (unsigned char)chunk->text[i]);
+			double gx = chunk->x + chunk->adv[i];
+
+			if (gx >= x1)
+				break;
+			if (gx + glyph->src.w <= x0 || !glyph->valid)
+				continue;
+
+			SDL_Rect dest = {(int)(gx - x0), (h - glyph->src.h) / 2, glyph->src.w, glyph->src.h};
+			batch_quad(&batch, atlas, glyph, &dest, color);
+		}
+	}
+
+	SDL_SetRenderTarget(ctx->renderer, tile->tex);
+	SDL_SetRenderDrawColor(ctx->renderer, 0, 0, 0, 0);
+	SDL_RenderClear(ctx->renderer);
+	batch_draw(&batch, ctx->renderer, atlas->tex);
+	SDL_SetRenderTarget(ctx->renderer, NULL);
+
+	tile->filled = ctx->scroll->x;
+}
+
+/* Resident tile for a piece of the line, rendering it if needed */
+static SDL_Texture *line_tile_get(DemoContext *ctx, long index, int h, Uint32 frame)
+{
+	LineTile *tile = NULL;
+
+	for (int i = 0; i < LINE_TILES; i++) {
+		if (line_tile[i].tex && line_tile[i].index == index) {
+			tile = &line_tile[i];
+			break;
+		}
+		if (!tile || line_tile[i].used < tile->used)
+			tile = &line_tile[i];
+	}
+
+	if (!tile->tex || tile->index != index) {
+		if (!tile->tex) {
+			tile->tex = SDL_CreateTexture(ctx->renderer, SDL_PIXELFORMAT_ARGB8888,
+						      SDL_TEXTUREACCESS_TARGET, LINE_TILE_W, h);
+			if (!tile->tex)
+				return NULL;
+			if (SDL_SetTextureBlendMode(tile->tex, line_tile_blend)) {
+				SDL_DestroyTexture(tile->tex);
+				tile->tex = NULL;
+				line_tiles_ok = 0;
+				return NULL;
 			}
 		}
+		tile->index = index;
+		line_tile_render(ctx, tile, h);
+	} else if (tile->filled < (index + 1) * (double)LINE_TILE_W && ctx->scroll->x > tile->filled) {
+		/* Text from the feed has arrived since */
+		line_tile_render(ctx, tile, h);
+	}
+	tile->used = frame;
+
+	return tile->tex;
+}
+
+/* Classic bottom scroller, flat yellow */
+static void render_classic_line(DemoContext *ctx)
+{
+	static Uint32 frame;
+	int h = TTF_FontHeight(ctx->font);
+	int y_pos = HEIGHT - 60;
+	long first = (long)floor((ctx->scroll_offset - WIDTH) / LINE_TILE_W);
+	long last = (long)floor(ctx->scroll_offset / LINE_TILE_W);
+
+	frame++;
+	for (long k = first; k <= last; k++) {
+		SDL_Texture *tex = line_tile_get(ctx, k, h, frame);
+
+		if (tex) {
+			SDL_Rect dest = {(int)(WIDTH + k * (double)LINE_TILE_W - ctx->scroll_offset),
+					 y_pos - h / 2, LINE_TILE_W, h};
+			SDL_RenderCopy(ctx->renderer, tex, NULL, &dest);
+		}
 	}
 }
 
-/* Helper to calculate spaces generated by SKIP command */
-static int calculate_skip_spaces(float skip_screens)
+/* Scroll text rendering with different styles */
+void render_scroll_text(DemoContext *ctx)
 {
-	return (int)(skip_screens * (WIDTH / 35.0f));
-}
+	/* All visible glyphs go into one batch, a single draw call */
+	static GlyphBatch batch;
+	GlyphAtlas *atlas = ctx->atlas;
 
-/* Build a map of control code positions in the stripped text */
-typedef struct {
-	int position;  /* Character position in stripped text */
-	float pixel_position;  /* Pixel position based on actual glyph widths */
-	char type;     /* P=pause, S=speed, T=style, C=color, K=skip */
-	char data[64]; /* Parameter data */
-} ControlCode;
+	if (ctx->scroll_style == SCROLL_NONE || !ctx->scroll || !atlas)
+		return;
 
-static ControlCode control_codes[256];
-static int num_control_codes = 0;
+	/* Update scroll offset - only advance when not paused */
+	if (ctx->last_frame_time == 0.0f) {
+		ctx->last_frame_time = ctx->global_time;
+	}
 
-static void build_control_map(const char *text)
-{
-	if (!text)
-		return;
+	float delta_time = ctx->global_time - ctx->last_frame_time;
+	ctx->last_frame_time = ctx->global_time;
 
-	num_control_codes = 0;
-	const char *p = text;
-	int char_pos = 0;  /* Position in stripped text */
-
-	while (*p && num_control_codes < 256) {
-		if (*p == '{') {
-			const char *start = p + 1;
-			const char *end = strchr(start, '}');
-
-			if (end) {
-				int len = end - start;
-				if (len > 0 && len < 64) {
-					char cmd[64] = {0};
-					strncpy(cmd, start, len);
-
-					ControlCode *cc = &control_codes[num_control_codes];
-					cc->position = char_pos;
-					cc->pixel_position = -1.0f;  /* Will be calculated later with actual font metrics */
-
-					if (strncmp(cmd, "PAUSE:", 6) == 0) {
-						cc->type = 'P';
-						strncpy(cc->data, cmd + 6, 63);
-						num_control_codes++;
-					} else if (strncmp(cmd, "SPEED:", 6) == 0) {
-						cc->type = 'S';
-						strncpy(cc->data, cmd + 6, 63);
-						num_control_codes++;
-					} else if (strncmp(cmd, "STYLE:", 6) == 0) {
-						cc->type = 'T';
-						strncpy(cc->data, cmd + 6, 63);
-						num_control_codes++;
-					} else if (strncmp(cmd, "COLOR:", 6) == 0) {
-						cc->type = 'C';
-						strncpy(cc->data, cmd + 6, 63);
-						num_control_codes++;
-					} else if (strncmp(cmd, "SKIP:", 5) == 0) {
-						/* SKIP is added to control codes for pixel position calculation */
-						cc->type = 'K';
-						strncpy(cc->data, cmd + 5, 63);
-						num_control_codes++;
-						/* Advance char_pos by the spaces that SKIP will insert */
-						float skip_screens = atof(cmd + 5);
-						char_pos += calculate_skip_spaces(skip_screens);
-					}
-				}
-				p = end + 1;
-				continue;
-			}
-		}
-		if (*p != '{' && *p != '}')
-			char_pos++;
-		p++;
+	if (ctx->global_time >= ctx->scroll_pause_until) {
+		ctx->scroll_offset += ctx->scroll_speed * delta_time;
 	}
-}
 
+	/*
+	 * Text position p is drawn at WIDTH + p - scroll_offset, characters
+	 * are culled to (-100, WIDTH + 100).  Lay out text up to the right
+	 * edge, then find the first character at the left edge and draw
+	 * forward from there.
+	 */
+	double left = ctx->scroll_offset - WIDTH - 100.0;
+	double right = ctx->scroll_offset + 100.0;
 
-/* Apply control codes based on current scroll position */
-static void apply_scroll_controls(DemoContext *ctx, float scroll_offset, float total_width)
-{
-	/* Track which control codes have been triggered */
-	static int triggered[256] = {0};
-	static int last_num_codes = 0;
-	static int last_cycle = -1;
+	if (ctx->scroll_style == SCROLL_CLASSIC && line_tiles_supported(ctx)) {
+		/* Whole tiles, the rightmost one reaches past the edge */
+		double tile_end = (floor(ctx->scroll_offset / LINE_TILE_W) + 1) * LINE_TILE_W;
 
-	/* Reset triggered flags if control codes changed */
-	if (num_control_codes != last_num_codes) {
-		for (int i = 0; i < 256; i++)
-			triggered[i] = 0;
-		last_num_codes = num_control_codes;
-	}
+		if (scroll_update(ctx->scroll, atlas, left, fmax(right, tile_end)) < 0)
+			return;
 
-	/* Detect wrapping by tracking which cycle we're in */
-	int current_cycle = (int)(scroll_offset / total_width);
-	if (current_cycle != last_cycle && last_cycle >= 0) {
-		/* We've wrapped to a new cycle - reset all triggered flags */
-		for (int i = 0; i < 256; i++)
-			triggered[i] = 0;
+		render_classic_line(ctx);
+		apply_scroll_controls(ctx);
+		return;
 	}
-	last_cycle = current_cycle;
 
-	/* Calculate scroll position within current cycle */
-	float cycle_offset = fmodf(scroll_offset, total_width);
+	if (scroll_update(ctx->scroll, atlas, left, right) < 0)
+		return;
 
-	/* Apply control codes that we've just reached (not yet triggered) */
-	for (int i = 0; i < num_control_codes; i++) {
-		ControlCode *cc = &control_codes[i];
-		float trigger_offset = 500.0f;
+	/*
+	 * Per-character animation is table driven: the wave, scale and
+	 * bounce phases start at this frame's phase plus the character
+	 * index times a per-character step, then step along with i.
+	 */
+	const Phase wave_t = PHASE(ctx->global_time / PI);          /* 2 rad/s */
+	const Phase wave_step = PHASE_RAD(0.3);
+	const Phase bounce_t = PHASE(ctx->global_time * 2.0 / PI);  /* 4 rad/s */
+	const Phase bounce_step = PHASE_RAD(0.5);
+	const int hue_t = (int)(ctx->global_time * 100) % LUT_HUES;
+	const int roller = ctx->roller_effect < 0 ? scene_quality(ctx)->roller : ctx->roller_effect;
+
+	for (int c = 0; c < ctx->scroll->num_chunks; c++) {
+		const ScrollChunk *chunk = &ctx->scroll->chunk[c];
+		Phase wave, bounce;
+		int i = 0, hue;
+
+		if (chunk->x + chunk->adv[chunk->len] < left)
+			continue;
+		if (chunk->x >= right)
+			break;
 
-		/* Trigger when we pass the pixel position plus offset (only once per cycle) */
-		if (!triggered[i] && cycle_offset >= cc->pixel_position + trigger_offset) {
-			triggered[i] = 1;
+		if (chunk->x < left)
+			i = scroll_chunk_find(chunk, left);
 
-			switch (cc->type) {
-			case 'P': /* PAUSE */
-				{
-					/* Use strtof for safer parsing with error checking */
-					char *endptr;
-					float pause_sec = strtof(cc->data, &endptr);
-					if (endptr != cc->data && pause_sec > 0) {
-						ctx->scroll_pause_until = ctx->global_time + pause_sec;
-					}
-				}
-				break;
+		wave = wave_t + (Phase)(chunk->index + i) * wave_step;
+		bounce = bounce_t + (Phase)(chunk->index + i) * bounce_step;
+		hue = (hue_t + (chunk->index + i) % LUT_HUES * 10) % LUT_HUES;
 
-			case 'S': /* SPEED */
-				{
-					char *endptr;
-					float new_speed = strtof(cc->data, &endptr);
-					if (endptr != cc->data && new_speed >= 0)
-						ctx->scroll_speed = new_speed;
-				}
-				break;
+		for (; i < chunk->len; i++, wave += wave_step, bounce += bounce_step,
+			     hue = hue >= LUT_HUES - 10 ? hue + 10 - LUT_HUES : hue + 10) {
+			float char_x = (float)(WIDTH + chunk->x + chunk->adv[i] - ctx->scroll_offset);
+			unsigned char ch = (unsigned char)chunk->text[i];
+			const AtlasGlyph *glyph = atlas_glyph(atlas, GLYPH_PLAIN, ch);
 
-			case 'T': /* STYLE */
-				if (strcmp(cc->data, "wave") == 0)
-					ctx->scroll_style = SCROLL_SINE_WAVE;
-				else if (strcmp(cc->data, "roller") == 0)
-					ctx->scroll_style = SCROLL_ROLLER_3D;
-				else if (strcmp(cc->data, "classic") == 0)
-					ctx->scroll_style = SCROLL_CLASSIC;
-				else if (strcmp(cc->data, "bounce") == 0)
-					ctx->scroll_style = SCROLL_BOUNCE;
+			if (char_x >= WIDTH + 100)
 				break;
+			if (char_x <= -100 || !glyph->valid)
+				continue;
 
-			case 'C': /* COLOR */
-				{
-					int r, g, b;
-					if (sscanf(cc->data, "%d,%d,%d", &r, &g, &b) == 3) {
-						ctx->scroll_color[0] = r;
-						ctx->scroll_color[1] = g;
-						ctx->scroll_color[2] = b;
-					}
-				}
-				break;
+			if (ctx->scroll_style == SCROLL_CLASSIC) {
+				/* Classic bottom scroller, without render targets */
+				SDL_Color color = {255, 255, 100, 255};
+				int y_pos = HEIGHT - 60;
+				SDL_Rect dest = {(int)char_x, y_pos - glyph->src.h / 2, glyph->src.w, glyph->src.h};
+
+				batch_quad(&batch, atlas, glyph, &dest, color);
+				continue;
 			}
-		}
-	}
-}
 
-/* Remove control codes from text for display */
-static char *strip_control_codes(const char *text)
-{
-	if (!text)
-		return NULL;
+			int y_pos = HEIGHT / 2 + ((lut_sin(wave) * 80) >> FX_SHIFT);
 
-	/* First pass: calculate required size accounting for SKIP expansions */
-	int expanded_len = 0;
-	const char *p = text;
-	while (*p) {
-		if (*p == '{') {
-			const char *end = strchr(p, '}');
-			if (end) {
-				int cmd_len = end - p - 1;
-				char cmd[64] = {0};
-				if (cmd_len > 0 && cmd_len < 64) {
-					strncpy(cmd, p + 1, cmd_len);
-					/* Check if this is a SKIP command */
-					if (strncmp(cmd, "SKIP:", 5) == 0) {
-						float skip_screens = atof(cmd + 5);
-						expanded_len += calculate_skip_spaces(skip_screens);
-					}
-				}
-				p = end + 1;
-				continue;
+			/* Update color - use custom color if set, otherwise gradient */
+			SDL_Color color = lut_rainbow[hue];
+			if (ctx->scroll_color[0] || ctx->scroll_color[1] || ctx->scroll_color[2]) {
+				color.r = ctx->scroll_color[0];
+				color.g = ctx->scroll_color[1];
+				color.b = ctx->scroll_color[2];
+			}
+
+			if (ctx->scroll_style == SCROLL_ROLLER_3D) {
+				/* 3D roller, outline and glow are baked into the glyph */
+				static const int look[] = {
+					GLYPH_GLOW_SHADOW, GLYPH_GLOW, GLYPH_PLAIN, GLYPH_GLOW_OUTLINE
+				};
+				float scale = 1.0f + lut_cos(wave) * (0.25f / FX_ONE);
+				const AtlasGlyph *baked = glyph;
+				int dh = (int)(glyph->src.h * scale);
+				int m = 0;
+
+				if (roller >= 0 && roller < 4)
+					baked = atlas_glyph(atlas, look[roller], ch);
+				if (!baked->valid && baked != glyph)
+					baked = atlas_glyph(atlas, GLYPH_GLOW, ch);
+				if (!baked->valid)
+					baked = glyph;
+				if (baked != glyph)
+					m = (int)(ATLAS_GLOW * scale);
+
+				SDL_Rect dest = {(int)char_x - m, y_pos - dh / 2 - m,
+						 (int)(baked->src.w * scale), (int)(baked->src.h * scale)};
+
+				batch_quad(&batch, atlas, baked, &dest, color);
+			} else if (ctx->scroll_style == SCROLL_BOUNCE) {
+				/* Bouncing characters - each char bounces independently */
+				/* Use abs(sin) to create bounce pattern (always positive) */
+				Sint32 bounce_height = abs(lut_sin(bounce));
+				/* Add slight squash at bottom */
+				float squash = 0.85f + bounce_height * (0.15f / FX_ONE);
+
+				int bounce_y = HEIGHT / 2 - ((bounce_height * 60) >> FX_SHIFT);
+				int dw = glyph->src.w;
+				int dh = (int)(glyph->src.h * squash);
+
+				SDL_Rect dest = {(int)char_x, bounce_y - dh / 2, dw, dh};
+				batch_quad(&batch, atlas, glyph, &dest, color);
+			} else {
+				/* Simple sine wave */
+				SDL_Rect dest = {(int)char_x, y_pos - glyph->src.h / 2, glyph->src.w, glyph->src.h};
+				batch_quad(&batch, atlas, glyph, &dest, color);
 			}
 		}
-		expanded_len++;
-		p++;
 	}
 
-	/* Allocate result with room for expansions */
-	char *result = malloc(expanded_len + 1);
-	if (!result)
-		return NULL;
+	/* One draw call for all glyphs */
+	batch_draw(&batch, ctx->renderer, atlas->tex);
 
-	/* Second pass: copy text and expand SKIP commands */
-	const char *src = text;
-	char *dst = result;
-
-	while (*src) {
-		if (*src == '{') {
-			const char *end = strchr(src, '}');
-			if (end) {
-				int cmd_len = end - src - 1;
-				char cmd[64] = {0};
-				if (cmd_len > 0 && cmd_len < 64) {
-					strncpy(cmd, src + 1, cmd_len);
-					/* Expand SKIP into spaces */
-					if (strncmp(cmd, "SKIP:", 5) == 0) {
-						float skip_screens = atof(cmd + 5);
-						int spaces = calculate_skip_spaces(skip_screens);
-						for (int i = 0; i < spaces; i++) {
-							*dst++ = ' ';
-						}
-					}
-				}
-				src = end + 1;
-				continue;
-			}
-		}
-		*dst++ = *src++;
+	/* Apply control codes based on scroll position */
+	apply_scroll_controls(ctx);
+}
+
+/* All scenes, by scene number */
+static const Scene scenes[NUM_SCENES] = {
+	[0] = {
+		.name    = "Starfield",
+		.size    = sizeof(StarfieldState),
+		.init    = starfield_init,
+		.upload  = starfield_upload,
+		.update  = starfield_update,
+		.render  = render_starfield,
+		.destroy = starfield_destroy,
+	},
+	[1] = {
+		.name    = "Plasma",
+		.size    = sizeof(PlasmaState),
+		.init    = plasma_init,
+		.upload  = plasma_upload,
+		.render  = render_plasma,
+		.destroy = plasma_destroy,
+	},
+	[2] = {
+		.name    = "Cube",
+		.size    = sizeof(CubeState),
+		.init    = cube_init,
+		.upload  = cube_upload,
+		.render  = render_cube,
+		.destroy = cube_destroy,
+	},
+	[3] = {
+		.name    = "Tunnel",
+		.size    = sizeof(TunnelState),
+		.init    = tunnel_init,
+		.render  = render_tunnel,
+		.destroy = tunnel_destroy,
+		.scalable = 1,
+	},
+	[4] = {
+		.name    = "Bouncing Logo",
+		.size    = sizeof(BouncingLogoState),
+		.init    = bouncing_logo_init,
+		.upload  = bouncing_logo_upload,
+		.update  = bouncing_logo_update,
+		.render  = render_bouncing_logo,
+		.destroy = logo_destroy,
+	},
+	[5] = {
+		.name    = "Raining Logo",
+		.size    = sizeof(RainingLogoState),
+		.init    = raining_logo_init,
+		.upload  = raining_logo_upload,
+		.update  = raining_logo_update,
+		.render  = render_raining_logo,
+		.destroy = logo_destroy,
+	},
+	[6] = {
+		.name    = "3D Star Ball",
+		.size    = sizeof(StarBallState),
+		.init    = star_ball_init,
+		.update  = star_ball_update,
+		.render  = render_star_ball,
+	},
+	[7] = {
+		.name    = "Rotozoomer",
+		.size    = sizeof(RotozoomState),
+		.init    = rotozoom_init,
+		.render  = render_rotozoomer,
+		.destroy = rotozoom_destroy,
+		.scalable = 1,
+	},
+	[8] = {
+		.name    = "Checkered Floor",
+		.size    = sizeof(FloorState),
+		.init    = floor_init,
+		.update  = floor_update,
+		.render  = render_checkered_floor,
+		.scalable = 1,
+	},
+};
+
+static const char *scene_names[NUM_SCENES];
+
+/*
+ * Upload the textures of a scene whose init returned rc, and make it
+ * ready to run.  On failure everything it loaded is released again.
+ */
+static int scene_ready(DemoContext *ctx, int scene, void *state, int rc)
+{
+	const Scene *sc = &scenes[scene];
+
+	if (!rc && sc->upload)
+		rc = sc->upload(ctx, state);
+	if (rc) {
+		if (sc->destroy)
+			sc->destroy(ctx, state);
+		free(state);
+		fprintf(stderr, "Warning: Failed to set up scene %s\n", sc->name);
+		return -1;
 	}
-	*dst = '\0';
+	ctx->scene_state[scene] = state;
 
-	return result;
+	return 0;
 }
 
-/* Scroll text rendering with different styles */
-void render_scroll_text(DemoContext *ctx)
+/*
+ * Wait for a prefetch to finish, or with wait unset only see if it has,
+ * and upload the textures of its scene.
+ */
+static void prefetch_finish(DemoContext *ctx, int wait)
 {
-	const char *text = ctx->scroll_text;
+	Prefetch *pf = &ctx->prefetch;
 
-	if (ctx->scroll_style == SCROLL_NONE || !text)
+	if (!pf->thread || (!wait && !SDL_AtomicGet(&pf->done)))
 		return;
 
-	/* Strip control codes for rendering and build control map */
-	static char *display_text = NULL;
-	static const char *last_text = NULL;
-	static int needs_pixel_calc = 1;
-	if (text != last_text) {
-		free(display_text);
-		display_text = strip_control_codes(text);
-		build_control_map(text);  /* Build map when text changes */
-		/* Pixel positions will be calculated later using the glyph cache */
-		needs_pixel_calc = 1;  /* Flag that we need to recalculate pixel positions */
-		last_text = text;
-	}
+	SDL_WaitThread(pf->thread, NULL);
+	pf->thread = NULL;
+	scene_ready(ctx, pf->scene, pf->state, pf->rc);
+}
 
-	if (!display_text)
-		return;
+/*
+ * Allocate the state of a scene and load what it needs, unless it is
+ * already running.  Only scenes about to be shown are set up, so small
+ * boards never pay for scenes left out of the scene list.
+ */
+static int scene_init(DemoContext *ctx, int scene)
+{
+	const Scene *sc = &scenes[scene];
+	void *state;
 
-	int text_len = strlen(display_text);
+	/* Images are shared, never set up two scenes at once */
+	prefetch_finish(ctx, 1);
+	if (ctx->scene_state[scene])
+		return 0;
 
-	/* Update scroll offset - only advance when not paused */
-	if (ctx->last_frame_time == 0.0f) {
-		ctx->last_frame_time = ctx->global_time;
+	state = calloc(1, sc->size);
+	if (!state) {
+		fprintf(stderr, "Warning: Failed to set up scene %s\n", sc->name);
+		return -1;
 	}
 
-	float delta_time = ctx->global_time - ctx->last_frame_time;
-	ctx->last_frame_time = ctx->global_time;
+	return scene_ready(ctx, scene, state, sc->init ? sc->init(ctx, state) : 0);
+}
 
-	if (ctx->global_time >= ctx->scroll_pause_until) {
-		ctx->scroll_offset += ctx->scroll_speed * delta_time;
-	}
+static int prefetch_worker(void *arg)
+{
+	DemoContext *ctx = arg;
+	Prefetch *pf = &ctx->prefetch;
+	const Scene *sc = &scenes[pf->scene];
 
-	if (ctx->scroll_style == SCROLL_SINE_WAVE || ctx->scroll_style == SCROLL_ROLLER_3D || ctx->scroll_style == SCROLL_BOUNCE) {
-		/* Glyph cache with metrics */
-		typedef struct {
-			SDL_Texture *tex;
-			SDL_Texture *tex_outline;
-			int w, h;
-			int adv;
-			int valid;
-		} Glyph;
-		static Glyph gcache[256];
-		static int initialized;
-		static int total_adv;
-
-		if (!initialized) {
-			memset(gcache, 0, sizeof(gcache));
-			TTF_SetFontKerning(ctx->font, 1);
-			initialized = 1;
-		}
+	pf->rc = sc->init ? sc->init(ctx, pf->state) : 0;
+	SDL_AtomicSet(&pf->done, 1);
 
-		/* Sine wave scroller (transparent, for plasma) */
-		float x_pos = WIDTH;
-
-		for (int i = 0; i < text_len; i++) {
-			char buffer[2] = {display_text[i], '\0'};
-			unsigned char ch = (unsigned char)display_text[i];
-
-			/* Render character if not cached */
-			if (!gcache[ch].valid && ch >= 32 && ch < 127) {
-				SDL_Color white = {255, 255, 255, 255};
-				SDL_Surface *surface = TTF_RenderText_Blended(ctx->font, buffer, white);
-				if (surface) {
-					int minx, maxx, miny, maxy, advance;
-					if (TTF_GlyphMetrics(ctx->font, ch, &minx, &maxx, &miny, &maxy, &advance) == 0)
-						gcache[ch].adv = advance;
-					else
-						gcache[ch].adv = surface->w;
-					gcache[ch].tex = SDL_CreateTextureFromSurface(ctx->renderer, surface);
-					gcache[ch].w = surface->w;
-					gcache[ch].h = surface->h;
-					gcache[ch].valid = 1;
-					SDL_FreeSurface(surface);
-
-					/* Outline cache for 3D roller */
-					if (ctx->font_outline && ctx->scroll_style == SCROLL_ROLLER_3D) {
-						SDL_Color black = {0, 0, 0, 255};
-						SDL_Surface *os = TTF_RenderText_Blended(ctx->font_outline, buffer, black);
-						if (os) {
-							gcache[ch].tex_outline = SDL_CreateTextureFromSurface(ctx->renderer, os);
-							SDL_FreeSurface(os);
-						}
-					}
-				}
-			}
+	return 0;
+}
 
-			float char_x = x_pos - ctx->scroll_offset;
+#define PREFETCH_LEAD 3000      /* Milliseconds before the fade */
 
-			/* Calculate total advance once per frame, and pixel positions for control codes */
-			if (i == 0) {
-#ifdef DEBUG_CONTROL_CODES
-				if (needs_pixel_calc) {
-					printf("Control code pixel positions calculated:\n");
-				}
-#endif
-				total_adv = 0;
-				float pixel_pos = 0.0f;
-				int cc_idx = 0;
-
-				for (int k = 0; k < text_len; k++) {
-					unsigned char ck = (unsigned char)display_text[k];
-
-					/* Update control code pixel positions at this character position */
-					if (needs_pixel_calc) {
-						while (cc_idx < num_control_codes && control_codes[cc_idx].position == k) {
-							control_codes[cc_idx].pixel_position = pixel_pos;
-#ifdef DEBUG_CONTROL_CODES
-							printf("  Position %d: pixel %.1f, type %c, data '%s'\n",
-							       control_codes[cc_idx].position,
-							       control_codes[cc_idx].pixel_position,
-							       control_codes[cc_idx].type,
-							       control_codes[cc_idx].data);
-#endif
-							cc_idx++;
-						}
-					}
+/*
+ * Start setting up a scene on a worker while the current one is still
+ * running, so the first frames after the switch do not have to decode
+ * images and build tables.  Textures are uploaded by prefetch_finish().
+ */
+static void scene_prefetch(DemoContext *ctx, int scene)
+{
+	Prefetch *pf = &ctx->prefetch;
 
-					int adv = gcache[ck].valid ? gcache[ck].adv : 35;
-					total_adv += adv;
-					pixel_pos += adv;
-#if SDL_TTF_VERSION_ATLEAST(2,0,18)
-					if (k > 0) {
-						unsigned char prev = (unsigned char)display_text[k - 1];
-						int kern = TTF_GetFontKerningSizeGlyphs(ctx->font, prev, ck);
-						total_adv += kern;
-						pixel_pos += kern;
-					}
-#endif
-				}
+	if (pf->thread || ctx->scene_state[scene])
+		return;
 
-				/* Handle control codes at end of text */
-				if (needs_pixel_calc) {
-					while (cc_idx < num_control_codes) {
-						control_codes[cc_idx].pixel_position = pixel_pos;
-#ifdef DEBUG_CONTROL_CODES
-						printf("  Position %d: pixel %.1f, type %c, data '%s'\n",
-						       control_codes[cc_idx].position,
-						       control_codes[cc_idx].pixel_position,
-						       control_codes[cc_idx].type,
-						       control_codes[cc_idx].data);
-#endif
-						cc_idx++;
-					}
-					needs_pixel_calc = 0;
-				}
-			}
+	/* On failure the scene is set up by scene_init() at the switch */
+	pf->state = calloc(1, scenes[scene].size);
+	if (!pf->state)
+		return;
 
-			/* Wrap around */
-			while (char_x < -100) char_x += total_adv;
+	pf->scene = scene;
+	SDL_AtomicSet(&pf->done, 0);
+	pf->thread = SDL_CreateThread(prefetch_worker, "prefetch", ctx);
+	if (!pf->thread) {
+		free(pf->state);
+		pf->state = NULL;
+	}
+}
 
-			if (char_x > -100 && char_x < WIDTH + 100 && gcache[ch].valid) {
-				float phase = ctx->global_time * 2.0f + i * 0.3f;
-				float wave = sinf(phase) * 80.0f;
-				int y_pos = HEIGHT / 2 + (int)wave;
+/* Release everything scene_init() set up, once a scene will not run again */
+static void scene_destroy(DemoContext *ctx, int scene)
+{
+	void *state = ctx->scene_state[scene];
 
-				/* Update color - use custom color if set, otherwise gradient */
-				Uint8 r, g, b;
-				if (ctx->scroll_color[0] || ctx->scroll_color[1] || ctx->scroll_color[2]) {
-					r = ctx->scroll_color[0];
-					g = ctx->scroll_color[1];
-					b = ctx->scroll_color[2];
-				} else {
-					int color_shift = (int)(ctx->global_time * 100 + i * 10) % 360;
-					r = (Uint8)(128 + 127 * sin(color_shift * PI / 180));
-					g = (Uint8)(128 + 127 * sin((color_shift + 120) * PI / 180));
-					b = (Uint8)(128 + 127 * sin((color_shift + 240) * PI / 180));
-				}
+	if (!state)
+		return;
 
-				if (ctx->scroll_style == SCROLL_ROLLER_3D) {
-					/* 3D roller with scale, outline, and glow */
-					float scale = 1.0f + 0.25f * cosf(phase);
-					int dw = (int)(gcache[ch].w * scale);
-					int dh = (int)(gcache[ch].h * scale);
-					SDL_Rect dest = {(int)char_x, y_pos - dh / 2, dw, dh};
-
-					/* Outline behind (configurable) */
-					if (ctx->roller_effect == 0 || ctx->roller_effect == 3) {
-						if (gcache[ch].tex_outline) {
-							if (ctx->roller_effect == 3) {
-								/* Color outline (thicker text effect) */
-								SDL_SetTextureColorMod(gcache[ch].tex_outline, r, g, b);
-							} else {
-								/* Black outline (drop shadow) */
-								SDL_SetTextureColorMod(gcache[ch].tex_outline, 0, 0, 0);
-							}
-							SDL_Rect od = dest;
-							od.x -= 1;
-							od.y -= 1;
-							SDL_RenderCopy(ctx->renderer, gcache[ch].tex_outline, NULL, &od);
-						}
-					}
+	if (scenes[scene].destroy)
+		scenes[scene].destroy(ctx, state);
+	free(state);
+	ctx->scene_state[scene] = NULL;
+}
 
-					/* Main glyph with color */
-					SDL_SetTextureColorMod(gcache[ch].tex, r, g, b);
-					SDL_RenderCopy(ctx->renderer, gcache[ch].tex, NULL, &dest);
-
-					/* Soft glow (configurable) */
-					if (ctx->roller_effect != 2) {
-						SDL_SetTextureBlendMode(gcache[ch].tex, SDL_BLENDMODE_ADD);
-						SDL_SetTextureAlphaMod(gcache[ch].tex, 40);
-						SDL_Rect glow = dest;
-						glow.x -= 2;
-						glow.y -= 2;
-						glow.w += 4;
-						glow.h += 4;
-						SDL_RenderCopy(ctx->renderer, gcache[ch].tex, NULL, &glow);
-						SDL_SetTextureAlphaMod(gcache[ch].tex, 255);
-						SDL_SetTextureBlendMode(gcache[ch].tex, SDL_BLENDMODE_BLEND);
-					}
-				} else if (ctx->scroll_style == SCROLL_BOUNCE) {
-					/* Bouncing characters - each char bounces independently */
-					float bounce_phase = ctx->global_time * 4.0f + i * 0.5f;
-					/* Use abs(sin) to create bounce pattern (always positive) */
-					float bounce_height = fabsf(sinf(bounce_phase)) * 60.0f;
-					/* Add slight squash at bottom */
-					float squash = 1.0f - (1.0f - fabsf(sinf(bounce_phase))) * 0.15f;
-
-					int bounce_y = HEIGHT / 2 - (int)bounce_height;
-					int dw = gcache[ch].w;
-					int dh = (int)(gcache[ch].h * squash);
-
-					SDL_SetTextureColorMod(gcache[ch].tex, r, g, b);
-					SDL_Rect dest = {(int)char_x, bounce_y - dh / 2, dw, dh};
-					SDL_RenderCopy(ctx->renderer, gcache[ch].tex, NULL, &dest);
-				} else {
-					/* Simple sine wave */
-					SDL_SetTextureColorMod(gcache[ch].tex, r, g, b);
-					SDL_Rect dest = {(int)char_x, y_pos - gcache[ch].h / 2, gcache[ch].w, gcache[ch].h};
-					SDL_RenderCopy(ctx->renderer, gcache[ch].tex, NULL, &dest);
-				}
-			}
+/* Advance and render one frame of the current scene, with the scroller on top */
+static void render_scene(DemoContext *ctx)
+{
+	const Scene *sc = &scenes[ctx->current_scene];
+	void *state = ctx->scene_state[ctx->current_scene];
 
-			/* Advance by glyph advance + kerning */
-			int adv = gcache[ch].valid ? gcache[ch].adv : 35;
-#if SDL_TTF_VERSION_ATLEAST(2,0,18)
-			if (i > 0) {
-				unsigned char prev = (unsigned char)text[i - 1];
-				int kern = TTF_GetFontKerningSizeGlyphs(ctx->font, prev, ch);
-				adv += kern;
-			}
-#endif
-			x_pos += adv;
-		}
+	if (state) {
+		if (sc->update)
+			sc->update(ctx, state);
+		sc->render(ctx, state);
+	} else {
+		/* Failed to set up, see scene_init() */
+		SDL_SetRenderDrawColor(ctx->renderer, 0, 0, 0, 255);
+		SDL_RenderClear(ctx->renderer);
+	}
 
-		/* Apply control codes based on scroll position */
-		apply_scroll_controls(ctx, ctx->scroll_offset, total_adv);
-	} else if (ctx->scroll_style == SCROLL_CLASSIC) {
-		/* Classic bottom scroller - render entire line once */
-		static SDL_Texture *line_tex = NULL;
-		static int line_w = 0;
-		static const char *last_display_text = NULL;
-
-		/* Rebuild texture if text changed */
-		if (!line_tex || display_text != last_display_text) {
-			if (line_tex) {
-				SDL_DestroyTexture(line_tex);
-				line_tex = NULL;
-			}
-			SDL_Color color = {255, 255, 100, 255};
-			SDL_Surface *surface = TTF_RenderText_Blended(ctx->font, display_text, color);
-			if (surface) {
-				line_tex = SDL_CreateTextureFromSurface(ctx->renderer, surface);
-				line_w = surface->w;
-				SDL_FreeSurface(surface);
-				last_display_text = display_text;
-
-				/* Calculate pixel positions for control codes using glyph metrics */
-				if (needs_pixel_calc) {
-#ifdef DEBUG_CONTROL_CODES
-					printf("Control code pixel positions calculated:\n");
-#endif
-					float pixel_pos = 0.0f;
-					int cc_idx = 0;
-
-					for (int k = 0; k < text_len; k++) {
-						unsigned char ch = (unsigned char)display_text[k];
-
-						/* Update control code pixel positions at this character position */
-						while (cc_idx < num_control_codes && control_codes[cc_idx].position == k) {
-							control_codes[cc_idx].pixel_position = pixel_pos;
-#ifdef DEBUG_CONTROL_CODES
-							printf("  Position %d: pixel %.1f, type %c, data '%s'\n",
-							       control_codes[cc_idx].position,
-							       control_codes[cc_idx].pixel_position,
-							       control_codes[cc_idx].type,
-							       control_codes[cc_idx].data);
-#endif
-							cc_idx++;
-						}
+	render_scroll_text(ctx);
+}
 
-						/* Get advance width for this character */
-						if (ch >= 32 && ch < 127) {
-							int minx, maxx, miny, maxy, advance;
-							if (TTF_GlyphMetrics(ctx->font, ch, &minx, &maxx, &miny, &maxy, &advance) == 0) {
-								pixel_pos += advance;
-							} else {
-								pixel_pos += 20;  /* Fallback */
-							}
-						} else {
-							pixel_pos += 20;  /* Fallback for non-printable */
-						}
-					}
+#define BENCH_HZ     60        /* Simulated frame rate of --bench */
+#define BENCH_WARMUP 30        /* Untimed frames before each scene */
 
-					/* Handle control codes at end of text */
-					while (cc_idx < num_control_codes) {
-						control_codes[cc_idx].pixel_position = pixel_pos;
-#ifdef DEBUG_CONTROL_CODES
-						printf("  Position %d: pixel %.1f, type %c, data '%s'\n",
-						       control_codes[cc_idx].position,
-						       control_codes[cc_idx].pixel_position,
-						       control_codes[cc_idx].type,
-						       control_codes[cc_idx].data);
-#endif
-						cc_idx++;
-					}
-					needs_pixel_calc = 0;
-				}
-			}
-		}
+/*
+ * Render num scenes for frames each, on a simulated clock so every run
+ * draws the same frames, and print one CSV line per scene.  Any display
+ * or vsync is already out of the picture, see main().
+ */
+static void run_bench(DemoContext *ctx, const int *list, int num, int frames)
+{
+	FrameClock clock;
 
-		/* Apply control codes based on scroll position */
-		apply_scroll_controls(ctx, ctx->scroll_offset, line_w);
+	frame_init_fixed(&clock, BENCH_HZ);
+	ctx->fade_alpha = 1.0f;
 
-		if (line_tex) {
-			int y_pos = HEIGHT - 60;
-			int h;
-			SDL_QueryTexture(line_tex, NULL, NULL, NULL, &h);
+	printf("scene,name,width,height,threads,frames,seconds,fps,ms_per_frame\n");
+	for (int s = 0; s < num; s++) {
+		Uint64 start = 0;
+		double sec;
 
-			/* Scroll position */
-			int scroll_x = (int)(WIDTH - ctx->scroll_offset);
-			while (scroll_x < -line_w) scroll_x += line_w;
+		/* Set up outside the timed frames, like a scene in the scene list */
+		ctx->current_scene = list[s];
+		scene_init(ctx, list[s]);
+		for (int i = -BENCH_WARMUP; i < frames; i++) {
+			if (i == 0)
+				start = frame_ns();
 
-			/* Draw the line, wrapping around */
-			SDL_Rect dest = {scroll_x, y_pos - h / 2, line_w, h};
-			SDL_RenderCopy(ctx->renderer, line_tex, NULL, &dest);
+			frame_begin(&clock);
+			ctx->sim_dt = clock.steps * FRAME_SIM_DT;
+			ctx->sim_steps = clock.steps;
+			ctx->time = (float)(i + BENCH_WARMUP) / BENCH_HZ;
+			ctx->global_time = (float)clock.now;
 
-			/* Draw wrapped copy if needed */
-			if (scroll_x + line_w < WIDTH) {
-				dest.x = scroll_x + line_w;
-				SDL_RenderCopy(ctx->renderer, line_tex, NULL, &dest);
-			}
+			SDL_PumpEvents();
+			render_scene(ctx);
+			SDL_RenderPresent(ctx->renderer);
 		}
+		sec = (frame_ns() - start) / 1e9;
+		scene_destroy(ctx, list[s]);
+
+		printf("%d,%s,%d,%d,%d,%d,%.3f,%.1f,%.3f\n", list[s], scenes[list[s]].name,
+		       WIDTH, HEIGHT, pool_threads(), frames, sec, frames / sec, sec * 1000 / frames);
+		fflush(stdout);
 	}
 }
 
@@ -2316,8 +2683,19 @@ static int usage(int rc)
 	printf("\nPlayback Options:\n");
 	printf("  -d, --duration SEC Scene duration in seconds (default: 15)\n");
 	printf("  -t, --text FILE    Load scroll text from file\n");
-	printf("  -r, --roller N     Roller effect: 0=all, 1=no outline, 2=clean, 3=color (default: 1)\n");
+	printf("  -a, --assets DIR   Load artwork from DIR, e.g. DIR/jack.png, instead of built-in\n");
+	printf("  -r, --roller N     Roller effect: 0=all, 1=no outline, 2=clean, 3=color (default: by quality)\n");
+	printf("  -q, --quality TIER Effect quality: low, medium, high, or ultra (default: high)\n");
+	printf("  -j, --threads N    Render threads for per-pixel effects (default: online CPUs)\n");
+	printf("  -F, --feed PATH    Scroll live text from a FIFO, or a UNIX socket created at PATH\n");
+	printf("  -R, --rate HZ      Frame rate, without vsync (default: display refresh rate)\n");
+	printf("  -S, --stats        Print frame times per scene on exit and on SIGUSR1\n");
+	printf("  -A, --adaptive     Lower quality, then resolution, of scenes to hold the frame rate\n");
+	printf("  -B, --bench FRAMES Render FRAMES of each scene offscreen, print CSV timings\n");
 	printf("  -h, --help         Show this help message\n");
+	printf("\nKeys:\n");
+	printf("  F1                 Toggle fps and frame time overlay\n");
+	printf("  Esc                Quit\n");
 	printf("\nScenes:\n");
 	printf("  0 - Starfield      3 - Tunnel           6 - 3D Star Ball\n");
 	printf("  1 - Plasma         4 - Bouncing Logo    7 - Rotozoomer\n");
@@ -2341,7 +2719,10 @@ int main(int argc, char *argv[])
 	int scale_factor = 1;
 	int auto_resolution = 1;  /* Auto-detect and adapt resolution */
 	const char *scroll_file_path = NULL;
-	int scene_list[6];
+	const char *assets_dir = NULL;
+	const char *feed_path = NULL;
+	Feed *feed = NULL;
+	int scene_list[16];
 	int num_scenes = 0;
 	int scene_duration = 15000;  /* Default: 15 seconds per scene */
 
@@ -2365,13 +2746,27 @@ int main(int argc, char *argv[])
 		{"window",     required_argument, NULL, 'w'},
 		{"scale",      required_argument, NULL, 's'},
 		{"text",       required_argument, NULL, 't'},
+		{"assets",     required_argument, NULL, 'a'},
 		{"roller",     required_argument, NULL, 'r'},
+		{"threads",    required_argument, NULL, 'j'},
+		{"feed",       required_argument, NULL, 'F'},
+		{"rate",       required_argument, NULL, 'R'},
+		{"quality",    required_argument, NULL, 'q'},
+		{"stats",      no_argument,       NULL, 'S'},
+		{"adaptive",   no_argument,       NULL, 'A'},
+		{"bench",      required_argument, NULL, 'B'},
 		{NULL,         0,                 NULL, 0}
 	};
 
 	int opt;
-	int roller_effect = 1;  /* Default: no outline, glow only */
-	while ((opt = getopt_long(argc, argv, "hd:fw:s:t:r:", long_options, NULL)) != -1) {
+	int roller_effect = -1; /* Default: by quality, no outline, glow only at high */
+	Quality quality_tier = QUALITY_HIGH;
+	int num_threads = 0;    /* Default: one per online CPU */
+	int frame_rate = 0;     /* Default: vsync, or the display refresh rate */
+	int show_stats = 0;
+	int adaptive = 0;
+	int bench_frames = 0;
+	while ((opt = getopt_long(argc, argv, "hd:fw:s:t:a:r:q:j:F:R:SAB:", long_options, NULL)) != -1) {
 		switch (opt) {
 		case 'h':
 			return usage(0);
@@ -2420,6 +2815,10 @@ int main(int argc, char *argv[])
 			scroll_file_path = optarg;
 			break;
 
+		case 'a':
+			assets_dir = optarg;
+			break;
+
 		case 'r':
 			roller_effect = atoi(optarg);
 			if (roller_effect < 0 || roller_effect > 3) {
@@ -2432,6 +2831,54 @@ int main(int argc, char *argv[])
 			}
 			break;
 
+		case 'q':
+			for (quality_tier = QUALITY_LOW; quality_tier < NUM_QUALITY; quality_tier++) {
+				if (!strcmp(optarg, quality[quality_tier].name))
+					break;
+			}
+			if (quality_tier == NUM_QUALITY) {
+				fprintf(stderr, "Error: Invalid quality '%s'. Use low, medium, high, or ultra\n", optarg);
+				return 1;
+			}
+			break;
+
+		case 'j':
+			num_threads = atoi(optarg);
+			if (num_threads < 1 || num_threads > POOL_MAX_THREADS) {
+				fprintf(stderr, "Error: Invalid thread count '%s'. Must be 1-%d\n",
+					optarg, POOL_MAX_THREADS);
+				return 1;
+			}
+			break;
+
+		case 'F':
+			feed_path = optarg;
+			break;
+
+		case 'R':
+			frame_rate = atoi(optarg);
+			if (frame_rate < 1 || frame_rate > 1000) {
+				fprintf(stderr, "Error: Invalid frame rate '%s'. Must be 1-1000\n", optarg);
+				return 1;
+			}
+			break;
+
+		case 'S':
+			show_stats = 1;
+			break;
+
+		case 'A':
+			adaptive = 1;
+			break;
+
+		case 'B':
+			bench_frames = atoi(optarg);
+			if (bench_frames < 1) {
+				fprintf(stderr, "Error: Invalid frame count '%s'. Must be positive.\n", optarg);
+				return 1;
+			}
+			break;
+
 		default:
 			return usage(1);
 		}
@@ -2440,8 +2887,8 @@ int main(int argc, char *argv[])
 	/* Parse non-option arguments as scene numbers */
 	for (int i = optind; i < argc; i++) {
 		int scene = atoi(argv[i]);
-		if (scene >= 0 && scene <= 8) {
-			if (num_scenes < 7) {
+		if (scene >= 0 && scene < NUM_SCENES) {
+			if (num_scenes < 16) {
 				scene_list[num_scenes++] = scene;
 			}
 		} else {
@@ -2450,8 +2897,22 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	/*
+	 * Benchmarks run without a display, at a fixed resolution.  The
+	 * offscreen driver needs SDL 2.0.22, dummy works everywhere.
+	 */
+	if (bench_frames) {
+		fullscreen = 0;
+		auto_resolution = 0;
+		if (!getenv("SDL_VIDEODRIVER")) {
+			setenv("SDL_VIDEODRIVER", "offscreen", 1);
+			if (SDL_Init(SDL_INIT_VIDEO) < 0)
+				setenv("SDL_VIDEODRIVER", "dummy", 1);
+		}
+	}
+
 	/* Initialize SDL and libraries */
-	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+	if (!SDL_WasInit(SDL_INIT_VIDEO) && SDL_Init(SDL_INIT_VIDEO) < 0) {
 		fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
 		return 1;
 	}
@@ -2469,9 +2930,15 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 
+	lut_init();
+
+	/* Start render workers (non-fatal, falls back to single-threaded) */
+	if (pool_init(num_threads))
+		fprintf(stderr, "Warning: Failed to start render threads: %s\n", SDL_GetError());
+
 	/* Initialize SDL_mixer for music (non-fatal if it fails) */
-	int audio_available = 1;
-	if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
+	int audio_available = !bench_frames;
+	if (audio_available && Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
 		fprintf(stderr, "Warning: Mix_OpenAudio failed: %s\n", Mix_GetError());
 		fprintf(stderr, "Continuing without audio...\n");
 		audio_available = 0;
@@ -2488,40 +2955,28 @@ int main(int argc, char *argv[])
 	ctx.scroll_color[1] = 0;
 	ctx.scroll_color[2] = 0;
 	ctx.scroll_style = SCROLL_ROLLER_3D;  /* Default scroll style */
-	ctx.scroll_offset = 0.0f;
+	ctx.scroll_offset = 0.0;
 	ctx.last_frame_time = 0.0f;
 	ctx.roller_effect = roller_effect;
+	ctx.quality = quality_tier;
+	ctx.adaptive = adaptive;    /* Governors are set up once the frame rate is known */
+	ctx.assets_dir = assets_dir;
 
 	/* Load scroll text from file or use default */
 	if (scroll_file_path) {
-		FILE *fp;
-
-		fp = fopen(scroll_file_path, "r");
-		if (fp) {
-			size_t i, read_bytes = 0;
-			long file_size;
-
-			fseek(fp, 0, SEEK_END);
-			file_size = ftell(fp);
-			fseek(fp, 0, SEEK_SET);
-
-			ctx.scroll_text = malloc(file_size + 1);
-			if (ctx.scroll_text) {
-				read_bytes = fread(ctx.scroll_text, 1, file_size, fp);
-				ctx.scroll_text[read_bytes] = '\0';
-			}
-			fclose(fp);
-
-			for (i = 0; i < read_bytes; i++) {
-				if (ctx.scroll_text[i] == '\n' || ctx.scroll_text[i] == '\r')
-					ctx.scroll_text[i] = ' ';
-			}
-		} else {
+		ctx.scroll = scroll_open(scroll_file_path, WIDTH);
+		if (!ctx.scroll)
 			fprintf(stderr, "Warning: Could not open '%s', using default text\n", scroll_file_path);
-			ctx.scroll_text = strdup(default_text);
-		}
-	} else {
-		ctx.scroll_text = strdup(default_text);
+	}
+	if (!ctx.scroll)
+		ctx.scroll = scroll_from_string(feed_path && !scroll_file_path ? "" : default_text, WIDTH);
+
+	/* Live text is laid out ahead of the rest as soon as it arrives */
+	if (feed_path && ctx.scroll) {
+		feed = feed_open(feed_path);
+		if (!feed)
+			fprintf(stderr, "Warning: Could not open feed '%s': %s\n", feed_path, strerror(errno));
+		ctx.scroll->feed = feed;
 	}
 
 	/* Handle scene selection */
@@ -2588,7 +3043,7 @@ int main(int argc, char *argv[])
 	/* fprintf(stderr, "Window: %dx%d, Render: %dx%d\n", */
 	/*         window_width, window_height, WIDTH, HEIGHT); */
 
-	Uint32 window_flags = SDL_WINDOW_SHOWN;
+	Uint32 window_flags = bench_frames ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN;
 	if (fullscreen) {
 		window_flags |= SDL_WINDOW_FULLSCREEN_DESKTOP;
 	}
@@ -2606,8 +3061,12 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 
-	ctx.renderer = SDL_CreateRenderer(ctx.window, -1,
-		SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+	/* A set frame rate is paced by frame_wait(), not the display */
+	if (bench_frames)
+		ctx.renderer = SDL_CreateRenderer(ctx.window, -1, SDL_RENDERER_SOFTWARE);
+	else
+		ctx.renderer = SDL_CreateRenderer(ctx.window, -1, SDL_RENDERER_ACCELERATED |
+						  (frame_rate ? 0 : SDL_RENDERER_PRESENTVSYNC));
 
 	/* Set logical rendering size - render at adapted resolution, display scales automatically */
 	SDL_RenderSetLogicalSize(ctx.renderer, WIDTH, HEIGHT);
@@ -2639,6 +3098,7 @@ int main(int argc, char *argv[])
 		SDL_Quit();
 		return 1;
 	}
+	TTF_SetFontKerning(ctx.font, 1);
 
 	/* Load outline font for 3D roller effect */
 	SDL_RWops *font_outline_rw = SDL_RWFromConstMem(topaz_8_otf, topaz_8_otf_len);
@@ -2649,155 +3109,28 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	/* Rasterize all scroller glyphs on a worker, the fonts are its until joined */
+	SDL_Thread *atlas_thread = SDL_CreateThread(atlas_worker, "atlas", &ctx);
+	if (!atlas_thread)
+		atlas_worker(&ctx);
+
 	ctx.pixels = malloc(WIDTH * HEIGHT * sizeof(Uint32));
 
-	/* Create plasma texture (lower resolution for performance) */
-	ctx.plasma_texture = SDL_CreateTexture(ctx.renderer,
-	                                       SDL_PIXELFORMAT_ARGB8888,
-	                                       SDL_TEXTUREACCESS_STREAMING,
-	                                       400, 300);
 	SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");  /* Nearest neighbor for retro look */
 
-	/* Load embedded jack.png from memory */
-	SDL_RWops *image_rw = SDL_RWFromConstMem(jack_png, jack_png_len);
-	if (!image_rw) {
-		fprintf(stderr, "Warning: Failed to create RWops for image: %s\n", SDL_GetError());
-		fprintf(stderr, "Cube will render without texture.\n");
-		ctx.jack_texture = NULL;
-		ctx.jack_surface = NULL;
-	} else {
-		ctx.jack_surface = IMG_Load_RW(image_rw, 1);  /* 1 = automatically close RW */
-		if (!ctx.jack_surface) {
-			fprintf(stderr, "Warning: Failed to load embedded image: %s\n", IMG_GetError());
-			fprintf(stderr, "Cube will render without texture.\n");
-			ctx.jack_texture = NULL;
-		} else {
-			/* Convert to RGB888 format to strip alpha channel */
-			SDL_Surface *converted = SDL_ConvertSurfaceFormat(ctx.jack_surface, SDL_PIXELFORMAT_RGB888, 0);
-			if (converted) {
-				SDL_FreeSurface(ctx.jack_surface);
-				ctx.jack_surface = converted;
-			}
-			/* Create and cache the texture */
-			ctx.jack_texture = SDL_CreateTextureFromSurface(ctx.renderer, ctx.jack_surface);
-			SDL_SetTextureBlendMode(ctx.jack_texture, SDL_BLENDMODE_NONE);
-			SDL_SetTextureAlphaMod(ctx.jack_texture, 255);
-			/* Use nearest neighbor to prevent edge artifacts from linear filtering */
-			SDL_SetTextureScaleMode(ctx.jack_texture, SDL_ScaleModeNearest);
-		}
-	}
-
-	/* Load embedded logo.png from memory */
-	SDL_RWops *logo_rw = SDL_RWFromConstMem(logo_png, logo_png_len);
-	if (!logo_rw) {
-		fprintf(stderr, "Warning: Failed to create RWops for logo: %s\n", SDL_GetError());
-		fprintf(stderr, "Bouncing logo scene will not render.\n");
-		ctx.logo_texture = NULL;
-		ctx.logo_surface = NULL;
-	} else {
-		ctx.logo_surface = IMG_Load_RW(logo_rw, 1);  /* 1 = automatically close RW */
-		if (!ctx.logo_surface) {
-			fprintf(stderr, "Warning: Failed to load embedded logo: %s\n", IMG_GetError());
-			fprintf(stderr, "Bouncing logo scene will not render.\n");
-			ctx.logo_texture = NULL;
-		} else {
-			/* Create and cache the texture */
-			ctx.logo_texture = SDL_CreateTextureFromSurface(ctx.renderer, ctx.logo_surface);
-			SDL_SetTextureBlendMode(ctx.logo_texture, SDL_BLENDMODE_BLEND);
-		}
-	}
-
-	/* Load embedded infix.png from memory */
-	SDL_RWops *infix_rw = SDL_RWFromConstMem(infix_png, infix_png_len);
-	if (!infix_rw) {
-		fprintf(stderr, "Warning: Failed to create RWops for infix: %s\n", SDL_GetError());
-		ctx.infix_texture = NULL;
-		ctx.infix_surface = NULL;
-	} else {
-		ctx.infix_surface = IMG_Load_RW(infix_rw, 1);  /* 1 = automatically close RW */
-		if (!ctx.infix_surface) {
-			fprintf(stderr, "Warning: Failed to load embedded infix: %s\n", IMG_GetError());
-			ctx.infix_texture = NULL;
-		} else {
-			/* Create and cache the texture */
-			ctx.infix_texture = SDL_CreateTextureFromSurface(ctx.renderer, ctx.infix_surface);
-			SDL_SetTextureBlendMode(ctx.infix_texture, SDL_BLENDMODE_BLEND);
-		}
-	}
-
-	/* Load embedded wires.png from memory */
-	SDL_RWops *wires_rw = SDL_RWFromConstMem(wires_png, wires_png_len);
-	if (!wires_rw) {
-		fprintf(stderr, "Warning: Failed to create RWops for wires: %s\n", SDL_GetError());
-		ctx.wires_texture = NULL;
-		ctx.wires_surface = NULL;
-	} else {
-		ctx.wires_surface = IMG_Load_RW(wires_rw, 1);  /* 1 = automatically close RW */
-		if (!ctx.wires_surface) {
-			fprintf(stderr, "Warning: Failed to load embedded wires: %s\n", IMG_GetError());
-			ctx.wires_texture = NULL;
-		} else {
-			/* Create and cache the texture */
-			ctx.wires_texture = SDL_CreateTextureFromSurface(ctx.renderer, ctx.wires_surface);
-			SDL_SetTextureBlendMode(ctx.wires_texture, SDL_BLENDMODE_BLEND);
-		}
-	}
-
-	/* Initialize starfield */
-	for (int i = 0; i < NUM_STARS; i++) {
-		ctx.stars[i].x = (rand() % 2000 - 1000) / 10.0f;
-		ctx.stars[i].y = (rand() % 2000 - 1000) / 10.0f;
-		ctx.stars[i].z = (rand() % 10000) / 100.0f;
-	}
-
-	/* Initialize tunnel LUT for optimization */
-	ctx.tunnel_distance = malloc(WIDTH * HEIGHT * sizeof(float));
-	ctx.tunnel_angle = malloc(WIDTH * HEIGHT * sizeof(float));
-	if (ctx.tunnel_distance && ctx.tunnel_angle) {
-		float center_x = WIDTH / 2.0f;
-		float center_y = HEIGHT / 2.0f;
-		for (int y = 0; y < HEIGHT; y++) {
-			for (int x = 0; x < WIDTH; x++) {
-				int idx = y * WIDTH + x;
-				float dx = x - center_x;
-				float dy = y - center_y;
-				ctx.tunnel_distance[idx] = sqrtf(dx * dx + dy * dy);
-				ctx.tunnel_angle[idx] = atan2f(dy, dx);
-			}
-		}
-	} else {
-		fprintf(stderr, "Warning: Failed to allocate tunnel LUT\n");
-	}
-
-	/* Initialize plasma LUT for optimization */
-	#define PLASMA_W 400
-	#define PLASMA_H 300
-	ctx.plasma_distance = malloc(PLASMA_W * PLASMA_H * sizeof(float));
-	ctx.plasma_palette = malloc(256 * sizeof(Uint32));
-	if (ctx.plasma_distance && ctx.plasma_palette) {
-		/* Pre-calculate distances for plasma */
-		float center_x = PLASMA_W / 2.0f;
-		float center_y = PLASMA_H / 2.0f;
-		for (int y = 0; y < PLASMA_H; y++) {
-			for (int x = 0; x < PLASMA_W; x++) {
-				int idx = y * PLASMA_W + x;
-				float dx = x - center_x;
-				float dy = y - center_y;
-				ctx.plasma_distance[idx] = sqrtf(dx * dx + dy * dy);
-			}
-		}
+	/* Set up the first scene while the glyphs are rasterized, the rest on demand */
+	if (!bench_frames)
+		scene_init(&ctx, ctx.current_scene);
 
-		/* Pre-calculate color palette (256 smooth colors) */
-		for (int i = 0; i < 256; i++) {
-			float v = i / 256.0f;
-			int r = (int)(128 + 127 * sinf(v * PI * 2.0f));
-			int g = (int)(128 + 127 * sinf(v * PI * 2.0f + 2.0f * PI / 3.0f));
-			int b = (int)(128 + 127 * sinf(v * PI * 2.0f + 4.0f * PI / 3.0f));
-			ctx.plasma_palette[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		}
-	} else {
-		fprintf(stderr, "Warning: Failed to allocate plasma LUT\n");
+	/* Upload all glyphs in one go, before the first frame */
+	if (atlas_thread)
+		SDL_WaitThread(atlas_thread, NULL);
+	if (ctx.atlas && atlas_upload(ctx.atlas, ctx.renderer)) {
+		atlas_destroy(ctx.atlas);
+		ctx.atlas = NULL;
 	}
+	if (!ctx.atlas)
+		fprintf(stderr, "Warning: Failed to create glyph atlas: %s\n", SDL_GetError());
 
 	/* Load and play music from embedded data */
 #ifdef HAVE_MUSIC
@@ -2815,12 +3148,65 @@ int main(int argc, char *argv[])
 	}
 #endif
 
+	/* Without vsync, pace frames to the display's refresh rate ourselves */
+	if (!frame_rate) {
+		SDL_RendererInfo info;
+
+		if (SDL_GetRendererInfo(ctx.renderer, &info) || !(info.flags & SDL_RENDERER_PRESENTVSYNC)) {
+			SDL_DisplayMode mode;
+
+			frame_rate = 60;
+			if (!SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(ctx.window), &mode) &&
+			    mode.refresh_rate > 0)
+				frame_rate = mode.refresh_rate;
+		}
+	}
+
+	/* Frames must render within one refresh, or the rate set with -R */
+	float frame_budget;
+	{
+		SDL_DisplayMode mode;
+		int hz = frame_rate;
+
+		if (!hz && !SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(ctx.window), &mode))
+			hz = mode.refresh_rate;
+		if (hz <= 0)
+			hz = 60;
+		frame_budget = 1000.0f / hz;
+	}
+
+	if (adaptive) {
+		for (int i = 0; i < NUM_SCENES; i++)
+			govern_init(&ctx.gov[i], quality_tier + 1 + (scenes[i].scalable ? NUM_RES - 1 : 0),
+				    frame_budget);
+	}
+
+	FrameClock clock;
 	int running = 1;
-	Uint32 start_time = SDL_GetTicks();
-	Uint32 scene_start = start_time;
+	int show_hud = 0;
+	Uint32 scene_start = 0;
+
+	for (int i = 0; i < NUM_SCENES; i++)
+		scene_names[i] = scenes[i].name;
+	stats_init(scene_names, show_stats);
+	frame_init(&clock, frame_rate);
+
+	if (bench_frames) {
+		static const int all[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+
+		if (num_scenes)
+			run_bench(&ctx, scene_list, num_scenes, bench_frames);
+		else
+			run_bench(&ctx, all, 9, bench_frames);
+		running = 0;
+	}
 
 	while (running) {
 		SDL_Event event;
+
+		frame_begin(&clock);
+		ctx.sim_dt = clock.steps * FRAME_SIM_DT;
+		ctx.sim_steps = clock.steps;
 		while (SDL_PollEvent(&event)) {
 			if (event.type == SDL_QUIT) {
 				running = 0;
@@ -2828,20 +3214,31 @@ int main(int argc, char *argv[])
 			if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
 				running = 0;
 			}
+			if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F1) {
+				show_hud = !show_hud;
+			}
 		}
 
-		Uint32 current_time = SDL_GetTicks();
+		Uint32 current_time = (Uint32)(clock.now * 1000);
 		ctx.time = (current_time - scene_start) / 1000.0f;
-		ctx.global_time = (current_time - start_time) / 1000.0f;
+		ctx.global_time = (float)clock.now;
 
 		/* Handle scene transitions with fade (only if not fixed) */
 		if (ctx.fixed_scene == -1) {
 			Uint32 scene_duration = current_time - scene_start;
 			float fade_duration = 300.0f;  /* 300ms fade */
 
+			/* Set up the next scene during the final seconds of this one */
+			if (ctx.num_scenes > 0 && !ctx.fading &&
+			    scene_duration + PREFETCH_LEAD > ctx.scene_duration) {
+				scene_prefetch(&ctx, ctx.scene_list[(ctx.current_scene_index + 1) % ctx.num_scenes]);
+				prefetch_finish(&ctx, 0);
+			}
+
 			if (scene_duration > ctx.scene_duration) {
-				/* Start fade out */
+				/* Start fade out, with the next scene ready to go */
 				if (!ctx.fading) {
+					prefetch_finish(&ctx, 1);
 					ctx.fading = 1;
 					ctx.fade_alpha = 1.0f;
 				}
@@ -2858,6 +3255,8 @@ int main(int argc, char *argv[])
 						if (ctx.num_scenes > 0) {
 							ctx.current_scene_index = (ctx.current_scene_index + 1) % ctx.num_scenes;
 							ctx.current_scene = ctx.scene_list[ctx.current_scene_index];
+							scene_init(&ctx, ctx.current_scene);
+							govern_reset(&ctx.gov[ctx.current_scene]);
 						}
 						scene_start = current_time - (Uint32)fade_duration;
 						ctx.time = 0;
@@ -2878,50 +3277,7 @@ int main(int argc, char *argv[])
 			ctx.fade_alpha = 1.0f;
 		}
 
-		/* Render current scene */
-		switch (ctx.current_scene) {
-		case 0:
-			render_starfield(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		case 1:
-			render_plasma(&ctx);
-			SDL_RenderClear(ctx.renderer);
-			SDL_RenderCopy(ctx.renderer, ctx.plasma_texture, NULL, NULL);
-			render_scroll_text(&ctx);
-			break;
-		case 2:
-			render_cube(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		case 3:
-			render_tunnel(&ctx);
-			SDL_UpdateTexture(ctx.texture, NULL, ctx.pixels, WIDTH * sizeof(Uint32));
-			SDL_RenderClear(ctx.renderer);
-			SDL_RenderCopy(ctx.renderer, ctx.texture, NULL, NULL);
-			render_scroll_text(&ctx);
-			break;
-		case 4:
-			render_bouncing_logo(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		case 5:
-			render_raining_logo(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		case 6:
-			render_star_ball(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		case 7:
-			render_rotozoomer(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		case 8:
-			render_checkered_floor(&ctx);
-			render_scroll_text(&ctx);
-			break;
-		}
+		render_scene(&ctx);
 
 		/* Apply fade effect */
 		if (ctx.fade_alpha < 1.0f) {
@@ -2931,50 +3287,49 @@ int main(int argc, char *argv[])
 			SDL_RenderFillRect(ctx.renderer, &fade_rect);
 		}
 
+		if (show_hud)
+			stats_hud(ctx.renderer, ctx.atlas, ctx.current_scene, frame_budget, 8, 8);
+
+		Uint64 present_start = frame_ns();
 		SDL_RenderPresent(ctx.renderer);
-		SDL_Delay(16);
+		Uint64 present_end = frame_ns();
+		frame_wait(&clock);
+
+		FrameTimes ft = {
+			.render  = (present_start - clock.last) / 1e6f,
+			.present = (present_end - present_start) / 1e6f,
+			.total   = (frame_ns() - clock.last) / 1e6f,
+		};
+		stats_add(ctx.current_scene, &ft);
+		stats_poll();
+
+		/* Fades include setting up the next scene, leave them out */
+		if (ctx.adaptive && !ctx.fading)
+			govern_frame(&ctx.gov[ctx.current_scene], ft.render);
 	}
 
+	stats_exit();
+
 	free(ctx.pixels);
-	free(ctx.scroll_text);
-	if (ctx.jack_surface) {
-		SDL_FreeSurface(ctx.jack_surface);
-	}
-	if (ctx.jack_texture) {
-		SDL_DestroyTexture(ctx.jack_texture);
-	}
-	if (ctx.logo_surface) {
-		SDL_FreeSurface(ctx.logo_surface);
-	}
-	if (ctx.logo_texture) {
-		SDL_DestroyTexture(ctx.logo_texture);
-	}
-	if (ctx.plasma_texture) {
-		SDL_DestroyTexture(ctx.plasma_texture);
-	}
+	scroll_close(ctx.scroll);
+	feed_close(feed);
+	prefetch_finish(&ctx, 1);
+	for (int i = 0; i < NUM_SCENES; i++)
+		scene_destroy(&ctx, i);
+	line_tiles_free();
+	atlas_destroy(ctx.atlas);
 	TTF_CloseFont(ctx.font);
 	if (ctx.font_outline) {
 		TTF_CloseFont(ctx.font_outline);
 	}
-	/* Free tunnel LUT */
-	if (ctx.tunnel_distance) {
-		free(ctx.tunnel_distance);
-	}
-	if (ctx.tunnel_angle) {
-		free(ctx.tunnel_angle);
-	}
-	/* Free plasma LUT */
-	if (ctx.plasma_distance) {
-		free(ctx.plasma_distance);
-	}
-	if (ctx.plasma_palette) {
-		free(ctx.plasma_palette);
-	}
+	if (ctx.scaled)
+		SDL_DestroyTexture(ctx.scaled);
 	SDL_DestroyTexture(ctx.texture);
 	SDL_DestroyRenderer(ctx.renderer);
 	SDL_DestroyWindow(ctx.window);
 	if (audio_available)
 		Mix_CloseAudio();
+	pool_exit();
 	IMG_Quit();
 	TTF_Quit();
 	SDL_Quit();
@@ -0,0 +1,290 @@
+/*
+ * Infix Demo — Live scroll text from a FIFO or UNIX socket
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * A reader thread blocks on the FIFO, or on connections to the socket,
+ * and publishes every line it reads into a ring of text segments.  The
+ * ring has one producer and one consumer, the scroller, so publishing a
+ * segment is just bumping an atomic head index after filling the slot,
+ * and consuming it bumps the tail.  SDL_AtomicSet() is no release, so
+ * each bump follows SDL_MemoryBarrierRelease(), and each read of the
+ * other side's index is followed by SDL_MemoryBarrierAcquire().  Neither side ever takes a lock or
+ * waits for the other, except the reader when the scroller is a whole
+ * ring behind, which pushes back on whoever is writing.
+ *
+ * Send text with, e.g.:
+ *
+ *     mkfifo /tmp/feed && demo --feed /tmp/feed &
+ *     echo "Hello from the bar!" > /tmp/feed
+ *
+ *     demo --feed /tmp/feed.sock &
+ *     echo "{COLOR:255,0,0}Doors close in 10 minutes" | nc -U /tmp/feed.sock
+ */
+
+#include <SDL2/SDL.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "feed.h"
+
+#define FEED_SLOTS    64       /* Lines in flight, power of two */
+#define SLOT(feed, i) (&(feed)->slot[(unsigned int)(i) % FEED_SLOTS])
+#define FEED_LINE_MAX 4096     /* Longer lines are split */
+#define FEED_BACKOFF  100      /* Milliseconds before retrying a failed accept() */
+
+struct Feed {
+	SDL_Thread   *thread;
+	char         *path;
+	int           fd;          /* FIFO, or listening socket */
+	int           listening;
+	int           wake[2];     /* Written to by feed_close() */
+	SDL_atomic_t  quit;
+
+	SDL_atomic_t  head;        /* Next slot to fill, written by the reader only */
+	SDL_atomic_t  tail;        /* Next slot to read, written by the scroller only */
+	struct {
+		char   *text;
+		size_t  len;
+	} slot[FEED_SLOTS];
+};
+
+/* Reader side: copy a line into the next slot, waiting if the ring is full */
+static void publish(Feed *feed, const char *text, size_t len)
+{
+	int head = SDL_AtomicGet(&feed->head);
+	char *copy;
+
+	/* Blank lines would only add a space */
+	if (len == 0 || (len == 1 && text[0] == '\n'))
+		return;
+
+	while (head - SDL_AtomicGet(&feed->tail) == FEED_SLOTS) {
+		if (SDL_AtomicGet(&feed->quit))
+			return;
+		SDL_Delay(20);
+	}
+	/* The scroller is done with the slot, including clearing it */
+	SDL_MemoryBarrierAcquire();
+
+	copy = malloc(len);
+	if (!copy)
+		return;
+	memcpy(copy, text, len);
+
+	SLOT(feed, head)->text = copy;
+	SLOT(feed, head)->len = len;
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&feed->head, head + 1);
+}
+
+static int reader(void *arg)
+{
+	Feed *feed = arg;
+	char line[FEED_LINE_MAX];
+	size_t n = 0;
+	int conn = -1;
+	int backoff = 0;
+
+	while (!SDL_AtomicGet(&feed->quit)) {
+		struct pollfd pfd[2] = {
+			{ .fd = feed->wake[0], .events = POLLIN },
+			{ .fd = conn >= 0 ? conn : feed->fd, .events = POLLIN },
+		};
+		ssize_t len;
+		char *nl;
+
+		/* Backing off, the socket stays readable, so only wait for quit */
+		if (poll(pfd, backoff ? 1 : 2, backoff ? FEED_BACKOFF : -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		if (pfd[0].revents)
+			break;
+		if (backoff) {
+			backoff = 0;
+			continue;
+		}
+		if (!pfd[1].revents)
+			continue;
+
+		/* One client at a time, the next one waits in the backlog */
+		if (feed->listening && conn < 0) {
+			conn = accept(feed->fd, NULL, NULL);
+			n = 0;
+
+			/* Out of descriptors or memory, e.g. EMFILE, the client stays queued */
+			if (conn < 0 && errno != EINTR && errno != ECONNABORTED && errno != EAGAIN)
+				backoff = 1;
+			continue;
+		}
+
+		len = read(pfd[1].fd, line + n, sizeof(line) - n);
+		if (len <= 0) {
+			if (len < 0 && errno == EINTR)
+				continue;
+			if (conn < 0)
+				break;
+
+			/* Client done, keep an unterminated last line */
+			publish(feed, line, n);
+			close(conn);
+			conn = -1;
+			n = 0;
+			continue;
+		}
+		n += len;
+
+		while ((nl = memchr(line, '\n', n))) {
+			size_t end = nl - line + 1;
+
+			publish(feed, line, end);
+			n -= end;
+			memmove(line, line + end, n);
+		}
+		if (n == sizeof(line)) {
+			publish(feed, line, n);
+			n = 0;
+		}
+	}
+
+	if (conn >= 0)
+		close(conn);
+
+	return 0;
+}
+
+static int listen_on(const char *path)
+{
+	struct sockaddr_un sun = { .sun_family = AF_UNIX };
+	int sd;
+
+	if (strlen(path) >= sizeof(sun.sun_path)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	strcpy(sun.sun_path, path);
+
+	sd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (sd < 0)
+		return -1;
+
+	if (bind(sd, (struct sockaddr *)&sun, sizeof(sun)) || listen(sd, 4)) {
+		close(sd);
+		return -1;
+	}
+
+	return sd;
+}
+
+Feed *feed_open(const char *path)
+{
+	struct stat st;
+	Feed *feed;
+
+	feed = calloc(1, sizeof(*feed));
+	if (!feed)
+		return NULL;
+	feed->fd = -1;
+	feed->wake[0] = feed->wake[1] = -1;
+
+	if (!stat(path, &st) && S_ISFIFO(st.st_mode)) {
+		/* Read-write, so the FIFO never sees EOF between writers */
+		feed->fd = open(path, O_RDWR | O_CLOEXEC);
+	} else {
+		/* Replace a stale socket from an earlier run, never a file */
+		if (!stat(path, &st)) {
+			if (!S_ISSOCK(st.st_mode)) {
+				errno = EEXIST;
+				goto fail;
+			}
+			unlink(path);
+		}
+
+		feed->fd = listen_on(path);
+		if (feed->fd >= 0) {
+			feed->listening = 1;
+			feed->path = strdup(path);
+		}
+	}
+	if (feed->fd < 0)
+		goto fail;
+
+	if (pipe(feed->wake))
+		goto fail;
+
+	feed->thread = SDL_CreateThread(reader, "feed", feed);
+	if (!feed->thread)
+		goto fail;
+
+	return feed;
+fail:
+	feed_close(feed);
+
+	return NULL;
+}
+
+void feed_close(Feed *feed)
+{
+	if (!feed)
+		return;
+
+	if (feed->thread) {
+		ssize_t rc;
+
+		SDL_AtomicSet(&feed->quit, 1);
+		rc = write(feed->wake[1], "", 1);
+		(void)rc;
+		SDL_WaitThread(feed->thread, NULL);
+	}
+
+	while (feed_peek(feed, NULL))
+		feed_pop(feed);
+
+	if (feed->wake[0] >= 0)
+		close(feed->wake[0]);
+	if (feed->wake[1] >= 0)
+		close(feed->wake[1]);
+	if (feed->fd >= 0)
+		close(feed->fd);
+	if (feed->listening && feed->path)
+		unlink(feed->path);
+	free(feed->path);
+	free(feed);
+}
+
+const char *feed_peek(Feed *feed, size_t *len)
+{
+	int tail = SDL_AtomicGet(&feed->tail);
+
+	if (tail == SDL_AtomicGet(&feed->head))
+		return NULL;
+	SDL_MemoryBarrierAcquire();     /* Slot is filled in before head moves */
+
+	if (len)
+		*len = SLOT(feed, tail)->len;
+
+	return SLOT(feed, tail)->text;
+}
+
+void feed_pop(Feed *feed)
+{
+	int tail = SDL_AtomicGet(&feed->tail);
+
+	if (tail == SDL_AtomicGet(&feed->head))
+		return;
+	SDL_MemoryBarrierAcquire();
+
+	free(SLOT(feed, tail)->text);
+	SLOT(feed, tail)->text = NULL;
+	SDL_MemoryBarrierRelease();     /* Cleared before the reader may refill it */
+	SDL_AtomicSet(&feed->tail, tail + 1);
+}
@@ -0,0 +1,22 @@
+/*
+ * Infix Demo — Live scroll text from a FIFO or UNIX socket
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef FEED_H
+#define FEED_H
+
+#include <stddef.h>
+
+typedef struct Feed Feed;
+
+/* Read lines from the FIFO at path, or listen on a UNIX socket there */
+Feed       *feed_open(const char *path);
+void        feed_close(Feed *feed);
+
+/* Oldest unread line, valid until feed_pop(), or NULL if none yet */
+const char *feed_peek(Feed *feed, size_t *len);
+void        feed_pop(Feed *feed);
+
+#endif /* FEED_H */
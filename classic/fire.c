@@ -0,0 +1,168 @@
+/*
+ * Infix Demo — Classic demoscene fire, any number of instances
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * The lodev.org fire: each cell is the average of the three cells below
+ * it and the one two rows below, slightly decayed, with a random bottom
+ * row feeding it.  The field wraps around at the edges.
+ *
+ * Rows are stored one byte per cell with a pad cell on each side, and
+ * an extra row below the bottom one.  The pads mirror the opposite edge,
+ * so the inner loop needs no modulo and runs 16 cells at a time with
+ * SSE2 or NEON.  Row y starts at offset 1 and is rounded up to a whole
+ * number of vectors, cells past w are scratch.
+ */
+
+#include <stdlib.h>
+#include "fire.h"
+
+#ifndef NO_SIMD
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HAVE_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HAVE_NEON
+#endif
+#endif
+
+/*
+ * Decay: (sum * 32) / 129, which for sum <= 4 * 255 is exactly the same
+ * as (sum * 16257) >> 16, a single 16-bit high multiply per cell.
+ */
+#define FIRE_DECAY_MUL 16257
+
+static inline Uint8 *row_ptr(Fire *fire, int y)
+{
+	return fire->cells + y * fire->stride + 1;
+}
+
+Fire *fire_create(int w, int h, int interval)
+{
+	Fire *fire;
+
+	if (w < 1 || h < 3)
+		return NULL;
+
+	fire = calloc(1, sizeof(*fire));
+	if (!fire)
+		return NULL;
+
+	fire->w        = w;
+	fire->h        = h;
+	fire->stride   = ((w + 15) & ~15) + 16;
+	fire->interval = interval > 0 ? interval : 1;
+
+	/* h rows plus the wrap-around row below the bottom */
+	fire->cells = calloc(h + 1, fire->stride);
+	if (!fire->cells) {
+		free(fire);
+		return NULL;
+	}
+
+	return fire;
+}
+
+void fire_destroy(Fire *fire)
+{
+	if (!fire)
+		return;
+
+	free(fire->cells);
+	free(fire);
+}
+
+/* Compute n cells of dst from the row below (with pads) and two below */
+static void propagate_row(Uint8 *dst, const Uint8 *below, const Uint8 *below2, int n)
+{
+	int x = 0;
+
+#if defined(HAVE_SSE2)
+	__m128i zero = _mm_setzero_si128();
+	__m128i mul  = _mm_set1_epi16(FIRE_DECAY_MUL);
+
+	for (; x < n; x += 16) {
+		__m128i l = _mm_loadu_si128((const __m128i *)(below + x - 1));
+		__m128i c = _mm_loadu_si128((const __m128i *)(below + x));
+		__m128i r = _mm_loadu_si128((const __m128i *)(below + x + 1));
+		__m128i d = _mm_loadu_si128((const __m128i *)(below2 + x));
+
+		__m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(l, zero), _mm_unpacklo_epi8(c, zero)),
+					   _mm_add_epi16(_mm_unpacklo_epi8(r, zero), _mm_unpacklo_epi8(d, zero)));
+		__m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(l, zero), _mm_unpackhi_epi8(c, zero)),
+					   _mm_add_epi16(_mm_unpackhi_epi8(r, zero), _mm_unpackhi_epi8(d, zero)));
+
+		lo = _mm_mulhi_epu16(lo, mul);
+		hi = _mm_mulhi_epu16(hi, mul);
+		_mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+	}
+#elif defined(HAVE_NEON)
+	uint16x4_t mul = vdup_n_u16(FIRE_DECAY_MUL);
+
+	for (; x < n; x += 16) {
+		uint8x16_t l = vld1q_u8(below + x - 1);
+		uint8x16_t c = vld1q_u8(below + x);
+		uint8x16_t r = vld1q_u8(below + x + 1);
+		uint8x16_t d = vld1q_u8(below2 + x);
+
+		uint16x8_t lo = vaddq_u16(vaddl_u8(vget_low_u8(l), vget_low_u8(c)),
+					  vaddl_u8(vget_low_u8(r), vget_low_u8(d)));
+		uint16x8_t hi = vaddq_u16(vaddl_u8(vget_high_u8(l), vget_high_u8(c)),
+					  vaddl_u8(vget_high_u8(r), vget_high_u8(d)));
+
+		lo = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(lo), mul), 16),
+				  vshrn_n_u32(vmull_u16(vget_high_u16(lo), mul), 16));
+		hi = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(hi), mul), 16),
+				  vshrn_n_u32(vmull_u16(vget_high_u16(hi), mul), 16));
+		vst1q_u8(dst + x, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+	}
+#endif
+
+	for (; x < n; x++) {
+		int sum = below[x - 1] + below[x] + below[x + 1] + below2[x];
+		dst[x] = (sum * FIRE_DECAY_MUL) >> 16;
+	}
+}
+
+void fire_step(Fire *fire)
+{
+	int w = fire->w;
+	int h = fire->h;
+
+	/* Randomize bottom row each step to create fire source */
+	Uint8 *bottom = row_ptr(fire, h - 1);
+	for (int x = 0; x < w; x++)
+		bottom[x] = rand() % 256;
+
+	for (int y = 0; y < h - 1; y++) {
+		Uint8 *below = row_ptr(fire, y + 1);
+
+		/* Horizontal wrap-around */
+		below[-1] = below[w - 1];
+		below[w]  = below[0];
+
+		/* The row above the bottom wraps to the top one, already updated */
+		if (y == h - 2) {
+			Uint8 *top = row_ptr(fire, 0);
+			Uint8 *pad = row_ptr(fire, h);
+
+			for (int x = 0; x < w; x++)
+				pad[x] = top[x];
+		}
+
+		propagate_row(row_ptr(fire, y), below, row_ptr(fire, y + 2), w);
+	}
+}
+
+int fire_update(Fire *fire)
+{
+	if (++fire->frame < fire->interval)
+		return 0;
+
+	fire->frame = 0;
+	fire_step(fire);
+
+	return 1;
+}
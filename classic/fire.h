@@ -0,0 +1,36 @@
+/*
+ * Infix Demo — Classic demoscene fire, any number of instances
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef FIRE_H
+#define FIRE_H
+
+#include <SDL2/SDL_stdinc.h>
+
+typedef struct {
+	int    w, h;       /* Size in cells */
+	int    stride;     /* Bytes per row, including padding */
+	int    interval;   /* Step the simulation every Nth fire_update() */
+	int    frame;
+	Uint8 *cells;      /* Heat, 0-255, see fire_row() */
+} Fire;
+
+/* Create a w x h fire that steps every interval:th frame */
+Fire *fire_create(int w, int h, int interval);
+void  fire_destroy(Fire *fire);
+
+/* Reseed the bottom row and propagate heat upwards one step */
+void  fire_step(Fire *fire);
+
+/* Count a frame, stepping when due, returns 1 if the fire changed */
+int   fire_update(Fire *fire);
+
+/* Heat of row y, columns 0 .. w - 1 */
+static inline const Uint8 *fire_row(const Fire *fire, int y)
+{
+	return fire->cells + y * fire->stride + 1;
+}
+
+#endif /* FIRE_H */
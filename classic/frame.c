@@ -0,0 +1,86 @@
+/*
+ * Infix Demo — Frame pacing and fixed-step simulation clock
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Each frame measures the real time since the previous one.  Effects
+ * that are a function of time use that directly, while the ones that
+ * integrate, falling balls and drifting stars, advance in fixed steps
+ * of FRAME_SIM_DT from an accumulator.  That way a bounce looks the
+ * same at 50, 60, or 144 Hz, and a slow frame is caught up instead of
+ * slowing everything down.
+ *
+ * With vsync, presenting a frame already blocks until the display is
+ * ready.  Without it, or with a frame rate set, frames are paced by
+ * sleeping until an absolute deadline on the monotonic clock, so the
+ * error from one frame does not carry over into the next.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include "frame.h"
+
+#define NSEC_PER_SEC 1000000000ULL
+
+Uint64 frame_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (Uint64)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+void frame_init(FrameClock *fc, int hz)
+{
+	memset(fc, 0, sizeof(*fc));
+	fc->start = fc->last = frame_ns();
+	if (hz > 0)
+		fc->period = NSEC_PER_SEC / hz;
+	fc->deadline = fc->start + fc->period;
+}
+
+void frame_init_fixed(FrameClock *fc, int hz)
+{
+	frame_init(fc, 0);
+	fc->fixed = NSEC_PER_SEC / hz;
+}
+
+void frame_begin(FrameClock *fc)
+{
+	Uint64 now = fc->fixed ? fc->last + fc->fixed : frame_ns();
+
+	fc->dt = (float)(now - fc->last) / NSEC_PER_SEC;
+	if (fc->dt > FRAME_DT_MAX)
+		fc->dt = FRAME_DT_MAX;
+	fc->last = now;
+	fc->now = (double)(now - fc->start) / NSEC_PER_SEC;
+
+	fc->acc += fc->dt;
+	fc->steps = (int)(fc->acc / FRAME_SIM_DT);
+	fc->acc -= fc->steps * FRAME_SIM_DT;
+}
+
+void frame_wait(FrameClock *fc)
+{
+	struct timespec ts;
+	Uint64 now;
+
+	if (!fc->period)
+		return;
+
+	/* Missed the deadline, start over from now rather than rush to catch up */
+	now = frame_ns();
+	if (now >= fc->deadline) {
+		fc->deadline = now + fc->period;
+		return;
+	}
+
+	ts.tv_sec = fc->deadline / NSEC_PER_SEC;
+	ts.tv_nsec = fc->deadline % NSEC_PER_SEC;
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+		;
+	fc->deadline += fc->period;
+}
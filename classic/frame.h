@@ -0,0 +1,44 @@
+/*
+ * Infix Demo — Frame pacing and fixed-step simulation clock
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <SDL2/SDL_stdinc.h>
+
+#define FRAME_SIM_HZ  240                  /* Simulation steps per second */
+#define FRAME_SIM_DT  (1.0f / FRAME_SIM_HZ)
+#define FRAME_DT_MAX  0.25f                /* Longer stalls are not caught up */
+
+typedef struct {
+	Uint64 start;          /* Monotonic nanoseconds at frame_init() */
+	Uint64 last;           /* ... at the start of this frame */
+	Uint64 period;         /* Nanoseconds per frame, 0 when vsync paces us */
+	Uint64 deadline;       /* When the next frame is due */
+	Uint64 fixed;          /* Simulated nanoseconds per frame, 0 for real time */
+
+	double now;            /* Seconds since frame_init() */
+	float  dt;             /* Measured seconds since the previous frame */
+	float  acc;            /* Simulation time not yet stepped */
+	int    steps;          /* Fixed steps due this frame */
+} FrameClock;
+
+/* Monotonic clock, in nanoseconds */
+Uint64 frame_ns(void);
+
+/* Start the clock, pace frames to hz, or 0 to leave that to vsync */
+void frame_init(FrameClock *fc, int hz);
+
+/* Same, but every frame takes exactly 1/hz seconds, for benchmarks */
+void frame_init_fixed(FrameClock *fc, int hz);
+
+/* Measure the frame and work out how many simulation steps are due */
+void frame_begin(FrameClock *fc);
+
+/* Sleep until the next frame is due, returns at once without a period */
+void frame_wait(FrameClock *fc);
+
+#endif /* FRAME_H */
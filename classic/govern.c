@@ -0,0 +1,46 @@
+/*
+ * Infix Demo — Frame time governor
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "govern.h"
+#include "stats.h"
+
+void govern_init(Governor *g, int num, float budget)
+{
+	g->level = 0;
+	g->num = num;
+	g->budget = budget;
+	govern_reset(g);
+}
+
+void govern_reset(Governor *g)
+{
+	g->frames = 0;
+}
+
+int govern_frame(Governor *g, float ms)
+{
+	int level = g->level;
+	float p;
+
+	g->ms[g->frames++] = ms;
+	if (g->frames < GOVERN_WINDOW)
+		return 0;
+
+	stats_sort(g->ms, g->frames);
+	p = stats_percentile(g->ms, g->frames, GOVERN_PCT);
+	if (p > g->budget * GOVERN_HIGH && level < g->num - 1)
+		level++;
+	else if (p < g->budget * GOVERN_LOW && level > 0)
+		level--;
+
+	govern_reset(g);
+	if (level == g->level)
+		return 0;
+
+	g->level = level;
+	return 1;
+}
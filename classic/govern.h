@@ -0,0 +1,39 @@
+/*
+ * Infix Demo — Frame time governor
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef GOVERN_H
+#define GOVERN_H
+
+#define GOVERN_WINDOW 60       /* Frames measured before each decision */
+#define GOVERN_PCT    95       /* Percentile of them that decides */
+#define GOVERN_HIGH   0.90f    /* Step down above this part of the budget */
+#define GOVERN_LOW    0.50f    /* Step up below it */
+
+/*
+ * Steps a level, 0 the best looking and num - 1 the cheapest, to keep
+ * the render time of frames within a budget.  The 95th percentile over
+ * a window of frames decides, so the odd slow frame does not tip it but
+ * regular hiccups do, and each decision starts a new window.  The
+ * gap between GOVERN_LOW and GOVERN_HIGH must be wider than the cost of
+ * one level, or it will keep stepping back and forth.
+ */
+typedef struct {
+	int   level;
+	int   num;             /* Levels */
+	float budget;          /* Milliseconds per frame */
+	float ms[GOVERN_WINDOW]; /* Render times in this window */
+	int   frames;          /* ... so far */
+} Governor;
+
+void govern_init(Governor *g, int num, float budget);
+
+/* Start a new window, e.g. when a scene starts again */
+void govern_reset(Governor *g);
+
+/* Add the render time of a frame, in milliseconds, returns 1 if the level changed */
+int govern_frame(Governor *g, float ms);
+
+#endif /* GOVERN_H */
@@ -0,0 +1,426 @@
+/*
+ * Infix Demo — Microbenchmark for the pixel kernels
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Times each kernel from kernels.c, and the fire, on its own, without
+ * SDL rendering, textures or vsync in the way.  Every kernel is run at
+ * a few resolutions and thread counts and the best frame of a series
+ * is reported, in nanoseconds and CPU cycles per pixel, as CSV:
+ *
+ *     make kbench && ./kbench > x86.csv
+ *     ./kbench -r 800x600 -j 1,4 -m 1800
+ *
+ * Cycles are nanoseconds times the CPU clock, the highest one reported
+ * by cpufreq unless given with -m, so they are a little optimistic on
+ * a CPU that throttles.
+ */
+
+#include <SDL2/SDL.h>
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fire.h"
+#include "frame.h"
+#include "kernels.h"
+#include "pool.h"
+
+#define MIN_FRAMES   20        /* Per measurement, at least ... */
+#define MIN_NSEC     250000000 /* ... and for at least a quarter second */
+#define TEX_SIZE     256       /* Rotozoomer texture */
+#define PIXELS_STAR  512       /* Star density, one per this many pixels */
+#define MAX_LIST     16
+
+typedef struct {
+	PixelBuf buf;
+	float    t;
+
+	float   *dist;             /* Plasma */
+	Uint32  *palette;
+	float   *sinx, *siny;
+	Uint32  *tunnel_lut;
+	Uint32  *tex;              /* Rotozoomer */
+	Star    *star;
+	int      num_stars;
+	Fire    *fire;
+} Bench;
+
+/* One frame of each kernel, with the same kind of parameters as the demo */
+static void plasma_rows(void *arg, int y0, int y1)
+{
+	Bench *b = arg;
+	PlasmaParams p = {
+		.dist    = b->dist,
+		.palette = b->palette,
+		.sinx    = b->sinx,
+		.siny    = b->siny,
+		.t       = b->t,
+		.drift_x = sinf(b->t * 0.15f) * 50.0f,
+		.drift_y = cosf(b->t * 0.2f) * 40.0f,
+	};
+
+	plasma_kernel(&b->buf, &p, y0, y1);
+}
+
+static void plasma_frame(Bench *b)
+{
+	for (int i = 0; i < b->buf.w * 2; i++)
+		b->sinx[i] = sinf(i * 0.02f + b->t);
+	for (int j = 0; j < b->buf.h * 2; j++)
+		b->siny[j] = sinf(j * 0.02f + b->t);
+
+	pool_for(0, b->buf.h, plasma_rows, b);
+}
+
+static void tunnel_rows(void *arg, int y0, int y1)
+{
+	Bench *b = arg;
+	TunnelParams p = {
+		.lut   = b->tunnel_lut,
+		.lut_x = b->buf.w / 2 - (int)(cosf(b->t * 0.5f) * b->buf.w / 8),
+		.lut_y = b->buf.h / 2 - (int)(sinf(b->t * 0.7f) * b->buf.h / 8),
+		.du    = (int)(b->t * 50.0f),
+		.dv    = (int)(b->t * 20.0f),
+	};
+
+	tunnel_kernel(&b->buf, &p, y0, y1);
+}
+
+static void tunnel_frame(Bench *b)
+{
+	pool_for(0, b->buf.h, tunnel_rows, b);
+}
+
+static void rotozoom_rows(void *arg, int y0, int y1)
+{
+	Bench *b = arg;
+	RotozoomParams p = {
+		.tex        = b->tex,
+		.tex_stride = TEX_SIZE,
+		.tex_w      = TEX_SIZE,
+		.tex_h      = TEX_SIZE,
+		.zoom       = 1.5f + sinf(b->t * 0.7f) * 0.8f,
+		.center_x   = b->buf.w / 2.0f,
+		.center_y   = b->buf.h / 2.0f,
+		.cos_a      = cosf(b->t * 0.5f),
+		.sin_a      = sinf(b->t * 0.5f),
+	};
+
+	rotozoom_kernel(&b->buf, &p, y0, y1);
+}
+
+static void rotozoom_frame(Bench *b)
+{
+	pool_for(0, b->buf.h, rotozoom_rows, b);
+}
+
+static void floor_rows(void *arg, int y0, int y1)
+{
+	Bench *b = arg;
+	FloorParams p = {
+		.pos_y     = b->t * 3.0f,
+		.dir_y     = 1.0f,
+		.plane_x   = 0.66f,
+		.z_far     = 50.0f,
+		.tile_size = 0.8f,
+	};
+
+	floor_kernel(&b->buf, &p, y0, y1);
+}
+
+static void floor_frame(Bench *b)
+{
+	pool_for(0, b->buf.h, floor_rows, b);
+}
+
+static void copper_rows(void *arg, int y0, int y1)
+{
+	Bench *b = arg;
+	CopperParams p = {
+		.t         = b->t,
+		.num       = 8,
+		.height    = b->buf.h / 20,
+		.speed     = 1.5f,
+		.spread    = 0.8f,
+		.amplitude = b->buf.h / 15.0f,
+		.hue_speed = 0.1f,
+		.value     = 255,
+	};
+
+	copper_kernel(&b->buf, &p, y0, y1);
+}
+
+static void copper_frame(Bench *b)
+{
+	pool_for(0, b->buf.h, copper_rows, b);
+}
+
+static void starfield_frame(Bench *b)
+{
+	for (int i = 0; i < b->num_stars; i++) {
+		b->star[i].z -= 1.6f;
+		if (b->star[i].z <= 0)
+			b->star[i].z += 100.0f;
+	}
+
+	starfield_kernel(&b->buf, b->star, b->num_stars);
+}
+
+static void fire_frame(Bench *b)
+{
+	fire_step(b->fire);
+}
+
+static const struct {
+	const char *name;
+	void      (*frame)(Bench *b);
+	int         serial;        /* Single-threaded, timed once */
+} kernels[] = {
+	{ "plasma",    plasma_frame,    0 },
+	{ "tunnel",    tunnel_frame,    0 },
+	{ "rotozoom",  rotozoom_frame,  0 },
+	{ "floor",     floor_frame,     0 },
+	{ "copper",    copper_frame,    0 },
+	{ "starfield", starfield_frame, 1 },
+	{ "fire",      fire_frame,      1 },
+};
+
+static void bench_free(Bench *b)
+{
+	free(b->buf.pixels);
+	free(b->dist);
+	free(b->palette);
+	free(b->sinx);
+	free(b->siny);
+	free(b->tunnel_lut);
+	free(b->tex);
+	free(b->star);
+	fire_destroy(b->fire);
+}
+
+static int bench_alloc(Bench *b, int w, int h)
+{
+	memset(b, 0, sizeof(*b));
+	b->buf = (PixelBuf){ malloc(w * h * sizeof(Uint32)), w, h, w };
+	b->dist = malloc(w * h * sizeof(float));
+	b->palette = malloc(256 * sizeof(Uint32));
+	b->sinx = malloc(w * 2 * sizeof(float));
+	b->siny = malloc(h * 2 * sizeof(float));
+	b->tunnel_lut = malloc(w * 2 * h * 2 * sizeof(Uint32));
+	b->tex = malloc(TEX_SIZE * TEX_SIZE * sizeof(Uint32));
+	b->num_stars = w * h / PIXELS_STAR;
+	b->star = malloc(b->num_stars * sizeof(Star));
+	b->fire = fire_create(w, h, 1);
+
+	if (!b->buf.pixels || !b->dist || !b->palette || !b->sinx || !b->siny ||
+	    !b->tunnel_lut || !b->tex || !b->star || !b->fire) {
+		bench_free(b);
+		return -1;
+	}
+
+	plasma_tables(b->dist, b->palette, w, h);
+	tunnel_table(b->tunnel_lut, w, h, 1.0f);
+	for (int y = 0; y < TEX_SIZE; y++) {
+		for (int x = 0; x < TEX_SIZE; x++)
+			b->tex[y * TEX_SIZE + x] = 0xFF000000 | ((x ^ y) * 0x010101);
+	}
+	for (int i = 0; i < b->num_stars; i++) {
+		b->star[i].x = (rand() % 2000 - 1000) / 10.0f;
+		b->star[i].y = (rand() % 2000 - 1000) / 10.0f;
+		b->star[i].z = 1 + rand() % 100;
+	}
+
+	return 0;
+}
+
+/* Best frame, in nanoseconds, of at least MIN_FRAMES and MIN_NSEC */
+static double measure(Bench *b, void (*frame)(Bench *b))
+{
+	Uint64 start = frame_ns(), best = ~0ULL;
+	int n = 0;
+
+	/* Warm up caches and LUTs */
+	frame(b);
+
+	while (n < MIN_FRAMES || frame_ns() - start < MIN_NSEC) {
+		Uint64 t0 = frame_ns(), t1;
+
+		b->t = n / 60.0f;
+		frame(b);
+		t1 = frame_ns();
+		if (t1 - t0 < best)
+			best = t1 - t0;
+		n++;
+	}
+
+	return (double)best;
+}
+
+/* Highest clock from cpufreq, in MHz, or 0 if not known */
+static double cpu_mhz(void)
+{
+	FILE *fp = fopen("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", "r");
+	double khz = 0;
+
+	if (!fp)
+		return 0;
+	if (fscanf(fp, "%lf", &khz) != 1)
+		khz = 0;
+	fclose(fp);
+
+	return khz / 1000;
+}
+
+/* Comma separated list of integers, or WxH pairs */
+static int parse_list(const char *arg, int *a, int *b, int max)
+{
+	int n = 0;
+
+	while (*arg && n < max) {
+		char *end;
+
+		a[n] = strtol(arg, &end, 10);
+		if (b) {
+			if (*end != 'x')
+				return -1;
+			b[n] = strtol(end + 1, &end, 10);
+		}
+		if (end == arg || a[n] < 1 || (b && b[n] < 1) || (*end && *end != ','))
+			return -1;
+		n++;
+		arg = *end ? end + 1 : end;
+	}
+
+	return n;
+}
+
+static int usage(int rc)
+{
+	printf("Usage: kbench [OPTIONS]\n");
+	printf("\nOptions:\n");
+	printf("  -r, --res WxH,...   Resolutions (default: 320x240,800x600,1280x720,1920x1080)\n");
+	printf("  -j, --threads N,... Thread counts (default: 1, 2, 4, ... up to online CPUs)\n");
+	printf("  -k, --kernel NAME   Only this kernel, may be repeated\n");
+	printf("  -m, --mhz MHZ       CPU clock for cycles per pixel (default: from cpufreq)\n");
+	printf("  -h, --help          Show this help message\n");
+	printf("\nKernels:\n ");
+	for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++)
+		printf(" %s", kernels[i].name);
+	printf("\n");
+
+	return rc;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct option long_options[] = {
+		{"res",     required_argument, NULL, 'r'},
+		{"threads", required_argument, NULL, 'j'},
+		{"kernel",  required_argument, NULL, 'k'},
+		{"mhz",     required_argument, NULL, 'm'},
+		{"help",    no_argument,       NULL, 'h'},
+		{NULL,      0,                 NULL, 0}
+	};
+	int res_w[MAX_LIST] = { 320, 800, 1280, 1920 };
+	int res_h[MAX_LIST] = { 240, 600, 720, 1080 };
+	int num_res = 4;
+	int threads[MAX_LIST];
+	int num_threads = 0;
+	const char *only[MAX_LIST];
+	int num_only = 0;
+	double mhz = 0;
+	int opt;
+
+	while ((opt = getopt_long(argc, argv, "r:j:k:m:h", long_options, NULL)) != -1) {
+		switch (opt) {
+		case 'r':
+			num_res = parse_list(optarg, res_w, res_h, MAX_LIST);
+			if (num_res < 1) {
+				fprintf(stderr, "Error: Invalid resolutions '%s'. Use WxH,WxH,...\n", optarg);
+				return 1;
+			}
+			break;
+
+		case 'j':
+			num_threads = parse_list(optarg, threads, NULL, MAX_LIST);
+			if (num_threads < 1) {
+				fprintf(stderr, "Error: Invalid thread counts '%s'. Use N,N,...\n", optarg);
+				return 1;
+			}
+			break;
+
+		case 'k':
+			if (num_only < MAX_LIST)
+				only[num_only++] = optarg;
+			break;
+
+		case 'm':
+			mhz = atof(optarg);
+			if (mhz <= 0) {
+				fprintf(stderr, "Error: Invalid clock '%s'. Must be positive.\n", optarg);
+				return 1;
+			}
+			break;
+
+		case 'h':
+			return usage(0);
+
+		default:
+			return usage(1);
+		}
+	}
+
+	if (!num_threads) {
+		int cpus = SDL_GetCPUCount();
+
+		for (int n = 1; n < cpus && num_threads < MAX_LIST - 1; n *= 2)
+			threads[num_threads++] = n;
+		threads[num_threads++] = cpus > 0 ? cpus : 1;
+	}
+	if (!mhz)
+		mhz = cpu_mhz();
+
+	printf("kernel,width,height,threads,ns_per_pixel,cycles_per_pixel,mpixels_per_sec\n");
+	for (int r = 0; r < num_res; r++) {
+		Bench b;
+
+		if (bench_alloc(&b, res_w[r], res_h[r])) {
+			fprintf(stderr, "Error: Out of memory at %dx%d\n", res_w[r], res_h[r]);
+			return 1;
+		}
+
+		for (int j = 0; j < num_threads; j++) {
+			if (pool_init(threads[j]))
+				fprintf(stderr, "Warning: Failed to start %d threads\n", threads[j]);
+
+			for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+				double pixels = (double)res_w[r] * res_h[r];
+				double ns;
+				int skip = num_only > 0;
+
+				for (int i = 0; i < num_only; i++) {
+					if (!strcmp(only[i], kernels[k].name))
+						skip = 0;
+				}
+				if (skip || (kernels[k].serial && j > 0))
+					continue;
+
+				ns = measure(&b, kernels[k].frame) / pixels;
+				printf("%s,%d,%d,%d,%.3f,", kernels[k].name, res_w[r], res_h[r],
+				       kernels[k].serial ? 1 : pool_threads(), ns);
+				if (mhz > 0)
+					printf("%.2f", ns * mhz / 1000);
+				printf(",%.1f\n", 1000 / ns);
+				fflush(stdout);
+			}
+
+			pool_exit();
+		}
+		bench_free(&b);
+	}
+
+	return 0;
+}
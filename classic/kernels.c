@@ -0,0 +1,418 @@
+/*
+ * Infix Demo — Pixel kernels, pure CPU loops without any SDL state
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "kernels.h"
+
+#ifndef NO_SIMD
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HAVE_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HAVE_NEON
+#endif
+#endif
+
+/* Step a fixed point coordinate and wrap it back into [0, size) */
+static inline Sint32 wrap_step(Sint32 c, Sint32 step, Sint32 size)
+{
+	c += step;
+	if (c >= size)
+		c -= size;
+	else if (c < 0)
+		c += size;
+
+	return c;
+}
+
+void rotozoom_span(Uint32 *dst, int n, const Uint32 *tex, int tex_stride,
+		   int tex_w, int tex_h, Sint32 u, Sint32 v, Sint32 du, Sint32 dv)
+{
+	Sint32 uw = tex_w << FX_SHIFT;
+	Sint32 vh = tex_h << FX_SHIFT;
+
+#if defined(HAVE_SSE2) || defined(HAVE_NEON)
+#if defined(HAVE_SSE2)
+	/* The texel index is a _mm_madd_epi16() of (v, u) by (stride, 1) */
+	if (n >= 8 && tex_stride < 32768) {
+#else
+	if (n >= 8) {
+#endif
+		Sint32 lu[4], lv[4];
+		int idx[4];
+
+		/* Four lanes, one pixel apart, each advanced four pixels per step */
+		for (int i = 0; i < 4; i++) {
+			lu[i] = u;
+			lv[i] = v;
+			u = wrap_step(u, du, uw);
+			v = wrap_step(v, dv, vh);
+		}
+		Sint32 su = (du * 4) % uw;
+		Sint32 sv = (dv * 4) % vh;
+
+#if defined(HAVE_SSE2)
+		__m128i vu    = _mm_loadu_si128((const __m128i *)lu);
+		__m128i vv    = _mm_loadu_si128((const __m128i *)lv);
+		__m128i vsu   = _mm_set1_epi32(su);
+		__m128i vsv   = _mm_set1_epi32(sv);
+		__m128i vuw   = _mm_set1_epi32(uw);
+		__m128i vvh   = _mm_set1_epi32(vh);
+		__m128i vuw1  = _mm_set1_epi32(uw - 1);
+		__m128i vvh1  = _mm_set1_epi32(vh - 1);
+		__m128i zero  = _mm_setzero_si128();
+		__m128i hi    = _mm_set1_epi32((int)0xFFFF0000);
+		/* (tx, ty) 16-bit pairs times (1, stride) gives the texel index */
+		__m128i mul   = _mm_set1_epi32(1 | (tex_stride << 16));
+
+		for (; n >= 4; n -= 4, dst += 4) {
+			__m128i txy = _mm_or_si128(_mm_srli_epi32(vu, FX_SHIFT), _mm_and_si128(vv, hi));
+			_mm_storeu_si128((__m128i *)idx, _mm_madd_epi16(txy, mul));
+
+			dst[0] = tex[idx[0]];
+			dst[1] = tex[idx[1]];
+			dst[2] = tex[idx[2]];
+			dst[3] = tex[idx[3]];
+
+			vu = _mm_add_epi32(vu, vsu);
+			vu = _mm_sub_epi32(vu, _mm_and_si128(_mm_cmpgt_epi32(vu, vuw1), vuw));
+			vu = _mm_add_epi32(vu, _mm_and_si128(_mm_cmplt_epi32(vu, zero), vuw));
+			vv = _mm_add_epi32(vv, vsv);
+			vv = _mm_sub_epi32(vv, _mm_and_si128(_mm_cmpgt_epi32(vv, vvh1), vvh));
+			vv = _mm_add_epi32(vv, _mm_and_si128(_mm_cmplt_epi32(vv, zero), vvh));
+		}
+
+		u = _mm_cvtsi128_si32(vu);
+		v = _mm_cvtsi128_si32(vv);
+#else
+		int32x4_t vu     = vld1q_s32(lu);
+		int32x4_t vv     = vld1q_s32(lv);
+		int32x4_t vsu    = vdupq_n_s32(su);
+		int32x4_t vsv    = vdupq_n_s32(sv);
+		int32x4_t vuw    = vdupq_n_s32(uw);
+		int32x4_t vvh    = vdupq_n_s32(vh);
+		int32x4_t stride = vdupq_n_s32(tex_stride);
+		int32x4_t zero   = vdupq_n_s32(0);
+
+		for (; n >= 4; n -= 4, dst += 4) {
+			int32x4_t ix = vmlaq_s32(vshrq_n_s32(vu, FX_SHIFT), vshrq_n_s32(vv, FX_SHIFT), stride);
+			vst1q_s32(idx, ix);
+
+			dst[0] = tex[idx[0]];
+			dst[1] = tex[idx[1]];
+			dst[2] = tex[idx[2]];
+			dst[3] = tex[idx[3]];
+
+			vu = vaddq_s32(vu, vsu);
+			vu = vsubq_s32(vu, vandq_s32(vreinterpretq_s32_u32(vcgeq_s32(vu, vuw)), vuw));
+			vu = vaddq_s32(vu, vandq_s32(vreinterpretq_s32_u32(vcltq_s32(vu, zero)), vuw));
+			vv = vaddq_s32(vv, vsv);
+			vv = vsubq_s32(vv, vandq_s32(vreinterpretq_s32_u32(vcgeq_s32(vv, vvh)), vvh));
+			vv = vaddq_s32(vv, vandq_s32(vreinterpretq_s32_u32(vcltq_s32(vv, zero)), vvh));
+		}
+
+		u = vgetq_lane_s32(vu, 0);
+		v = vgetq_lane_s32(vv, 0);
+#endif
+	}
+#endif
+
+	/* Scalar fallback, and the tail of the SIMD loop */
+	while (n-- > 0) {
+		*dst++ = tex[(v >> FX_SHIFT) * tex_stride + (u >> FX_SHIFT)];
+		u = wrap_step(u, du, uw);
+		v = wrap_step(v, dv, vh);
+	}
+}
+
+/* Distance from the center, and a smooth 256 color rainbow */
+void plasma_tables(float *dist, Uint32 *palette, int w, int h)
+{
+	float center_x = w / 2.0f;
+	float center_y = h / 2.0f;
+
+	for (int y = 0; y < h; y++) {
+		for (int x = 0; x < w; x++) {
+			float dx = x - center_x;
+			float dy = y - center_y;
+
+			dist[y * w + x] = sqrtf(dx * dx + dy * dy);
+		}
+	}
+
+	for (int i = 0; i < 256; i++) {
+		float v = i / 256.0f;
+		int r = (int)(128 + 127 * sinf(v * M_PI * 2.0f));
+		int g = (int)(128 + 127 * sinf(v * M_PI * 2.0f + 2.0f * M_PI / 3.0f));
+		int b = (int)(128 + 127 * sinf(v * M_PI * 2.0f + 4.0f * M_PI / 3.0f));
+
+		palette[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+	}
+}
+
+void plasma_kernel(const PixelBuf *buf, const PlasmaParams *p, int y0, int y1)
+{
+	int w = buf->w, h = buf->h;
+
+	for (int y = y0; y < y1; y++) {
+		Uint32 *dst = &buf->pixels[y * buf->stride];
+
+		for (int x = 0; x < w; x++) {
+			int fx = (int)(x + p->drift_x);
+			int fy = (int)(y + p->drift_y);
+
+			/* Clamp to LUT bounds */
+			fx = (fx < 0) ? 0 : ((fx >= w * 2) ? w * 2 - 1 : fx);
+			fy = (fy < 0) ? 0 : ((fy >= h * 2) ? h * 2 - 1 : fy);
+
+			float dist_sin = sinf(p->dist[y * w + x] * 0.02f + p->t * 1.2f);
+			float v = p->sinx[fx] + p->siny[fy] + p->sinx[(fx + fy) % (w * 2)] + dist_sin;
+
+			/* Use color palette LUT - convert value to palette index */
+			dst[x] = p->palette[(int)(v * 32.0f) & 0xFF];
+		}
+	}
+}
+
+/*
+ * Tunnel lookup table, twice the screen size in both directions and
+ * centred on (w, h).  Any eye position on screen then maps to a w x h
+ * window inside it, so the moving eye costs nothing.  Each entry packs,
+ * already scaled to texture space:
+ *
+ *   bits  0-7   depth coordinate, 1000 / distance at full resolution
+ *   bits  8-15  angle coordinate, 100 * angle / PI
+ *   bits 16-23  vignette, 255 at the eye fading to 0 at w / 2
+ *
+ * Below full resolution, scale is the size of the screen relative to
+ * it, e.g. 0.5 at half, so the tunnel looks the same at any size.
+ */
+void tunnel_table(Uint32 *lut, int w, int h, float scale)
+{
+	int lut_w = w * 2;
+	int lut_h = h * 2;
+
+	for (int y = 0; y < lut_h; y++) {
+		for (int x = 0; x < lut_w; x++) {
+			float dx = x - w;
+			float dy = y - h;
+
+			float distance = sqrtf(dx * dx + dy * dy);
+			if (distance < 1.0f) distance = 1.0f; /* Avoid division by zero */
+
+			int depth = (int)(1000.0f * scale / distance) & 0xFF;
+			int angle = (int)(atan2f(dy, dx) / M_PI * 100.0f) & 0xFF;
+
+			float vignette = 1.0f - (distance / (w / 2));
+			if (vignette < 0) vignette = 0;
+			int shade = (int)(vignette * 255.0f);
+
+			lut[y * lut_w + x] = (shade << 16) | (angle << 8) | depth;
+		}
+	}
+}
+
+void tunnel_kernel(const PixelBuf *buf, const TunnelParams *p, int y0, int y1)
+{
+	int lut_w = buf->w * 2;
+
+	for (int y = y0; y < y1; y++) {
+		const Uint32 *lut = &p->lut[(y + p->lut_y) * lut_w + p->lut_x];
+		Uint32 *dst = &buf->pixels[y * buf->stride];
+
+		for (int x = 0; x < buf->w; x++) {
+			Uint32 e = lut[x];
+
+			int texture_x = (e + p->du) & 0xFF;
+			int texture_y = ((e >> 8) + p->dv) & 0xFF;
+			int shade = e >> 16;
+
+			int pattern = (texture_x ^ texture_y);
+
+			int r = (pattern & 0xFF);
+			int g = ((pattern << 2) & 0xFF);
+			int b = ((pattern << 4) & 0xFF);
+
+			r = (r * shade) >> 8;
+			g = (g * shade) >> 8;
+			b = (b * shade) >> 8;
+
+			dst[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+		}
+	}
+}
+
+void rotozoom_kernel(const PixelBuf *buf, const RotozoomParams *p, int y0, int y1)
+{
+	int tex_w = p->tex_w;
+	int tex_h = p->tex_h;
+
+	/* Texture steps along a scanline, constant for the whole frame */
+	float du = p->cos_a / p->zoom;
+	float dv = p->sin_a / p->zoom;
+
+	for (int y = y0; y < y1; y++) {
+		/* Rotated and zoomed texture coordinate of the first pixel */
+		float dx = -p->center_x / p->zoom;
+		float dy = (y - p->center_y) / p->zoom;
+		float u = dx * p->cos_a - dy * p->sin_a + tex_w / 2.0f;
+		float v = dx * p->sin_a + dy * p->cos_a + tex_h / 2.0f;
+
+		/* Wrap into texture space, the span keeps it there */
+		u = fmodf(u, tex_w);
+		if (u < 0) u += tex_w;
+		v = fmodf(v, tex_h);
+		if (v < 0) v += tex_h;
+
+		Sint32 fu = FX(u), fv = FX(v);
+		if (fu >= tex_w << FX_SHIFT) fu = 0;
+		if (fv >= tex_h << FX_SHIFT) fv = 0;
+
+		rotozoom_span(&buf->pixels[y * buf->stride], buf->w, p->tex, p->tex_stride,
+			      tex_w, tex_h, fu, fv, FX(du), FX(dv));
+	}
+}
+
+/* Floor casting (based on lodev.org algorithm), rows below the horizon */
+void floor_kernel(const PixelBuf *buf, const FloorParams *p, int y0, int y1)
+{
+	int w = buf->w, h = buf->h;
+
+	/* Ray directions for leftmost and rightmost rays */
+	float ray_x0 = p->dir_x - p->plane_x;
+	float ray_y0 = p->dir_y - p->plane_y;
+	float ray_x1 = p->dir_x + p->plane_x;
+	float ray_y1 = p->dir_y + p->plane_y;
+
+	for (int y = y0; y < y1; y++) {
+		Uint32 *dst = &buf->pixels[y * buf->stride];
+
+		/* Calculate row distance (vertical screen position to floor distance) */
+		int row = y - h / 2;
+
+		/* Skip the center horizon line to avoid division by zero */
+		if (row == 0) continue;
+
+		float pos_z = 0.5f * h;
+		float distance = pos_z / row;
+
+		/* Calculate floor step (how much texture coords change per screen X pixel) */
+		float step_x = distance * (ray_x1 - ray_x0) / w;
+		float step_y = distance * (ray_y1 - ray_y0) / w;
+
+		/* Starting floor position for this row */
+		float floor_x = p->pos_x + distance * ray_x0;
+		float floor_y = p->pos_y + distance * ray_y0;
+
+		/* Distance fog, the same for the whole row */
+		float fog = 1.0f - fminf(distance / p->z_far, 0.7f);
+		int light = (int)(255 * fog);
+		int dark = (int)(50 * fog);
+		Uint32 color[2] = {
+			0xFF000000 | (dark << 16) | (dark << 8) | dark,
+			0xFF000000 | (light << 16) | (light << 8) | light,
+		};
+
+		for (int x = 0; x < w; x++) {
+			/* Add small offset at center to avoid symmetry artifacts */
+			float check_x = floor_x;
+			if (x == w / 2) check_x += 0.01f;
+
+			int cell_x = (int)floorf(check_x / p->tile_size);
+			int cell_y = (int)floorf(floor_y / p->tile_size);
+
+			/* Checkerboard pattern */
+			dst[x] = color[(cell_x + cell_y) & 1];
+
+			/* Advance to next pixel */
+			floor_x += step_x;
+			floor_y += step_y;
+		}
+	}
+}
+
+void copper_kernel(const PixelBuf *buf, const CopperParams *p, int y0, int y1)
+{
+	for (int i = 0; i < p->num; i++) {
+		/* Calculate bar position with sine wave motion */
+		float base_y = (i * buf->h / p->num) + sinf(p->t * p->speed + i * p->spread) * p->amplitude;
+
+		/* HSV to RGB for rainbow effect */
+		float hue = (i / (float)p->num + p->t * p->hue_speed);
+		hue = hue - floorf(hue);  /* Keep in 0-1 range */
+
+		int h_section = (int)(hue * 6);
+		float f = hue * 6 - h_section;
+		int v = p->value;
+		int q = (int)(v * (1 - f));
+		int t_val = (int)(v * f);
+
+		int r, g, b;
+		switch (h_section % 6) {
+		case 0: r = v; g = t_val; b = 0; break;
+		case 1: r = q; g = v; b = 0; break;
+		case 2: r = 0; g = v; b = t_val; break;
+		case 3: r = 0; g = q; b = v; break;
+		case 4: r = t_val; g = 0; b = v; break;
+		default: r = v; g = 0; b = q; break;
+		}
+
+		/* Draw bar with gradient */
+		for (int dy = 0; dy < p->height; dy++) {
+			int y = (int)base_y + dy;
+
+			if (y < y0 || y >= y1)
+				continue;
+
+			/* Gradient brightness based on position in bar, squared for sharper falloff */
+			float brightness = 1.0f - fabsf(dy - p->height / 2.0f) / (p->height / 2.0f);
+			brightness = brightness * brightness;
+
+			int br = (int)(r * brightness);
+			int bg = (int)(g * brightness);
+			int bb = (int)(b * brightness);
+
+			Uint32 color = 0xFF000000 | (br << 16) | (bg << 8) | bb;
+			Uint32 *dst = &buf->pixels[y * buf->stride];
+			for (int x = 0; x < buf->w; x++)
+				dst[x] = color;
+		}
+	}
+}
+
+void starfield_kernel(const PixelBuf *buf, const Star *star, int n)
+{
+	int w = buf->w, h = buf->h, stride = buf->stride;
+	Uint32 *pixels = buf->pixels;
+
+	for (int i = 0; i < n; i++) {
+		/* Project 3D to 2D */
+		float k = 128.0f / star[i].z;
+		int sx = w / 2 + (int)(star[i].x * k);
+		int sy = h / 2 + (int)(star[i].y * k);
+
+		if (sx < 0 || sx >= w || sy < 0 || sy >= h)
+			continue;
+
+		/* Calculate brightness based on distance */
+		int brightness = (int)(255 * (1.0f - star[i].z / 100.0f));
+		if (brightness < 0) brightness = 0;
+		if (brightness > 255) brightness = 255;
+
+		Uint32 color = 0xFF000000 | (brightness << 16) | (brightness << 8) | brightness;
+		pixels[sy * stride + sx] = color;
+
+		/* Draw larger stars for closer ones */
+		if (star[i].z < 20.0f && sx > 0 && sy > 0 && sx < w - 1 && sy < h - 1) {
+			pixels[sy * stride + sx - 1] = color;
+			pixels[sy * stride + sx + 1] = color;
+			pixels[(sy - 1) * stride + sx] = color;
+			pixels[(sy + 1) * stride + sx] = color;
+		}
+	}
+}
@@ -0,0 +1,101 @@
+/*
+ * Infix Demo — Pixel kernels, pure CPU loops without any SDL state
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <SDL2/SDL_stdinc.h>
+
+/* 16.16 fixed point helpers */
+#define FX_SHIFT  16
+#define FX_ONE    (1 << FX_SHIFT)
+#define FX(f)     ((Sint32)((f) * FX_ONE))
+
+/*
+ * Texture map one span of n pixels, wrapping around the texture edges.
+ * Start coordinate (u, v) and per-pixel step (du, dv) are 16.16 fixed
+ * point, with 0 <= u < tex_w and 0 <= v < tex_h, and each step must be
+ * less than one texture width/height.  In 16.16 tex_w and tex_h must be
+ * less than 32768.  Uses SSE2 on x86_64 and NEON on ARM, build with
+ * -DNO_SIMD for the plain C version.  The SSE2 texel index is 16-bit
+ * math, so there wider textures, tex_stride >= 32768, use the plain C
+ * loop, NEON has no such limit.
+ */
+void rotozoom_span(Uint32 *dst, int n, const Uint32 *tex, int tex_stride,
+		   int tex_w, int tex_h, Sint32 u, Sint32 v, Sint32 du, Sint32 dv);
+
+/*
+ * The per-pixel effects, split from their scenes so they can be timed
+ * on their own, see kbench.c.  Each kernel renders rows [y0, y1) of a
+ * pixel buffer from a set of per-frame parameters, and is safe to call
+ * concurrently on disjoint rows, e.g. from pool_for().
+ */
+typedef struct {
+	Uint32 *pixels;
+	int     w, h;
+	int     stride;        /* In pixels */
+} PixelBuf;
+
+typedef struct {
+	const float  *dist;    /* w x h distance from the center, see plasma_tables() */
+	const Uint32 *palette; /* 256 colors */
+	const float  *sinx;    /* sin(i * 0.02 + t), 2w entries */
+	const float  *siny;    /* ... 2h entries */
+	float         t;
+	float         drift_x, drift_y;
+} PlasmaParams;
+
+typedef struct {
+	const Uint32 *lut;     /* 2w x 2h, see tunnel_table() */
+	int           lut_x, lut_y; /* Top left of the screen window in the LUT */
+	int           du, dv;  /* Texture scroll */
+} TunnelParams;
+
+typedef struct {
+	const Uint32 *tex;
+	int           tex_stride, tex_w, tex_h;
+	float         zoom;
+	float         center_x, center_y;
+	float         cos_a, sin_a;
+} RotozoomParams;
+
+typedef struct {
+	float pos_x, pos_y;    /* Camera position */
+	float dir_x, dir_y;    /* Camera direction */
+	float plane_x, plane_y; /* Camera plane, for the field of view */
+	float z_far;           /* Fog distance */
+	float tile_size;
+} FloorParams;
+
+/* Rainbow bars, bar i is centered near i * h / num and bobs up and down */
+typedef struct {
+	float t;
+	int   num;
+	int   height;          /* Of each bar, in pixels */
+	float speed, spread;   /* y offset is sin(t * speed + i * spread) * amplitude */
+	float amplitude;
+	float hue_speed;       /* Turns per second */
+	int   value;           /* Brightness at the middle of a bar, 0-255 */
+} CopperParams;
+
+typedef struct {
+	float x, y, z;
+} Star;
+
+void plasma_tables(float *dist, Uint32 *palette, int w, int h);
+void plasma_kernel(const PixelBuf *buf, const PlasmaParams *p, int y0, int y1);
+
+void tunnel_table(Uint32 *lut, int w, int h, float scale);
+void tunnel_kernel(const PixelBuf *buf, const TunnelParams *p, int y0, int y1);
+
+void rotozoom_kernel(const PixelBuf *buf, const RotozoomParams *p, int y0, int y1);
+void floor_kernel(const PixelBuf *buf, const FloorParams *p, int y0, int y1);
+void copper_kernel(const PixelBuf *buf, const CopperParams *p, int y0, int y1);
+
+/* Project and plot n stars, z in (0, 100], not row based */
+void starfield_kernel(const PixelBuf *buf, const Star *star, int n);
+
+#endif /* KERNELS_H */
@@ -0,0 +1,33 @@
+/*
+ * Infix Demo — Fixed-point sine and rainbow lookup tables
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * The scrollers animate every visible character every frame, a sine
+ * for the wave, another for the scale or bounce, and three for the
+ * color.  With the tables below that is a handful of adds and loads
+ * per character instead of libm calls.  The sine table is 4096 entries
+ * of 16.16, which is well below a pixel of error at the amplitudes the
+ * demo uses.
+ */
+
+#include <math.h>
+#include "lut.h"
+
+Sint32    lut_sine[LUT_SIZE];
+SDL_Color lut_rainbow[LUT_HUES];
+
+void lut_init(void)
+{
+	for (int i = 0; i < LUT_SIZE; i++)
+		lut_sine[i] = (Sint32)lrint(sin(i * 2 * M_PI / LUT_SIZE) * FX_ONE);
+
+	/* Three sines 120 degrees apart, the classic demo rainbow */
+	for (int h = 0; h < LUT_HUES; h++) {
+		lut_rainbow[h].r = (Uint8)(128 + 127 * sin(h * M_PI / 180));
+		lut_rainbow[h].g = (Uint8)(128 + 127 * sin((h + 120) * M_PI / 180));
+		lut_rainbow[h].b = (Uint8)(128 + 127 * sin((h + 240) * M_PI / 180));
+		lut_rainbow[h].a = 255;
+	}
+}
@@ -0,0 +1,44 @@
+/*
+ * Infix Demo — Fixed-point sine and rainbow lookup tables
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef LUT_H
+#define LUT_H
+
+#include <SDL2/SDL_pixels.h>
+#include "kernels.h"
+
+#define LUT_BITS    12
+#define LUT_SIZE    (1 << LUT_BITS)
+#define LUT_HUES    360
+
+/*
+ * Phases are 16.16 fixed point in turns, so only the fraction matters
+ * and accumulators can wrap freely: add a step per character, per
+ * frame, and read the table.  Arithmetic is done in Uint32 to keep the
+ * wraparound well defined.
+ */
+typedef Uint32 Phase;
+
+#define PHASE(turns)     ((Phase)(Sint64)((turns) * (double)FX_ONE))
+#define PHASE_RAD(rad)   PHASE((rad) / 6.28318530717958647692)
+
+extern Sint32    lut_sine[LUT_SIZE];     /* sin(), 16.16 fixed point */
+extern SDL_Color lut_rainbow[LUT_HUES];  /* Full saturation, one per degree */
+
+/* Fill in the tables, once at startup */
+void lut_init(void);
+
+static inline Sint32 lut_sin(Phase phase)
+{
+	return lut_sine[(phase >> (FX_SHIFT - LUT_BITS)) & (LUT_SIZE - 1)];
+}
+
+static inline Sint32 lut_cos(Phase phase)
+{
+	return lut_sin(phase + FX_ONE / 4);
+}
+
+#endif /* LUT_H */
@@ -0,0 +1,181 @@
+/*
+ * Infix Demo — Build the pack of pre-decoded images
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Decodes each image, converts it to the pixel format the demo uses,
+ * ARGB8888 or with :rgb RGB888 without alpha, and writes them all to
+ * one pack, see pack.h.  Run at build time by the Makefile:
+ *
+ *     ./mkpack -o assets.pak jack.png:rgb logo.png infix.png wires.png
+ *
+ * With -z, when built with LZ4=1, images are stored LZ4 compressed,
+ * which trades a little time at startup for a smaller binary.
+ */
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_LZ4
+#include <lz4hc.h>
+#endif
+#include "pack.h"
+
+#define MAX_IMAGES 32
+
+typedef struct {
+	PackEntry    entry;
+	SDL_Surface *surface;
+	void        *data;     /* Stored pixels, surface->pixels unless compressed */
+} Image;
+
+static int usage(int rc)
+{
+	fprintf(stderr, "Usage: mkpack [-z] -o FILE IMAGE[:rgb]...\n"
+		"  -o FILE  Write pack to FILE\n"
+		"  -z       Compress with LZ4, needs a build with LZ4=1\n"
+		"  :rgb     Strip alpha channel, store as RGB888\n");
+
+	return rc;
+}
+
+static int load(Image *img, char *arg, int compress)
+{
+	Uint32 format = SDL_PIXELFORMAT_ARGB8888;
+	char *suffix = strrchr(arg, ':');
+	char *name, *dot;
+	size_t raw;
+
+	if (suffix && !strcmp(suffix, ":rgb")) {
+		format = SDL_PIXELFORMAT_RGB888;
+		*suffix = 0;
+	}
+
+	SDL_Surface *surface = IMG_Load(arg);
+	if (!surface) {
+		fprintf(stderr, "mkpack: %s: %s\n", arg, IMG_GetError());
+		return -1;
+	}
+	img->surface = SDL_ConvertSurfaceFormat(surface, format, 0);
+	SDL_FreeSurface(surface);
+	if (!img->surface) {
+		fprintf(stderr, "mkpack: %s: %s\n", arg, SDL_GetError());
+		return -1;
+	}
+
+	name = basename(arg);
+	dot = strrchr(name, '.');
+	if (dot)
+		*dot = 0;
+	if (strlen(name) >= PACK_NAME) {
+		fprintf(stderr, "mkpack: %s: name too long, max %d\n", name, PACK_NAME - 1);
+		return -1;
+	}
+
+	strcpy(img->entry.name, name);
+	img->entry.format = format;
+	img->entry.w = img->surface->w;
+	img->entry.h = img->surface->h;
+	img->entry.pitch = img->surface->pitch;
+
+	raw = (size_t)img->surface->pitch * img->surface->h;
+	img->entry.size = raw;
+	img->data = img->surface->pixels;
+
+#ifdef HAVE_LZ4
+	if (compress) {
+		int max = LZ4_compressBound(raw);
+		char *buf = malloc(max);
+		int len;
+
+		if (!buf)
+			return -1;
+
+		/* Only pays off if smaller, else it is stored as is */
+		len = LZ4_compress_HC(img->surface->pixels, buf, raw, max, LZ4HC_CLEVEL_MAX);
+		if (len > 0 && (size_t)len < raw) {
+			img->entry.size = len;
+			img->data = buf;
+		} else {
+			free(buf);
+		}
+	}
+#else
+	(void)compress;
+#endif
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static Image img[MAX_IMAGES];
+	PackHeader hdr = { .magic = PACK_MAGIC, .version = PACK_VERSION };
+	const char *out = NULL;
+	int compress = 0;
+	Uint32 offset;
+	FILE *fp;
+	int c;
+
+	while ((c = getopt(argc, argv, "ho:z")) != -1) {
+		switch (c) {
+		case 'h':
+			return usage(0);
+		case 'o':
+			out = optarg;
+			break;
+		case 'z':
+#ifndef HAVE_LZ4
+			fprintf(stderr, "mkpack: built without LZ4, storing uncompressed\n");
+#endif
+			compress = 1;
+			break;
+		default:
+			return usage(1);
+		}
+	}
+	if (!out || optind == argc || argc - optind > MAX_IMAGES)
+		return usage(1);
+
+	for (int i = optind; i < argc; i++) {
+		if (load(&img[hdr.count++], argv[i], compress))
+			return 1;
+	}
+
+	/* Pixel data follows the entries, each aligned for the renderer */
+	offset = sizeof(hdr) + hdr.count * sizeof(PackEntry);
+	for (Uint32 i = 0; i < hdr.count; i++) {
+		offset = (offset + PACK_ALIGN - 1) & ~(PACK_ALIGN - 1);
+		img[i].entry.offset = offset;
+		offset += img[i].entry.size;
+	}
+
+	fp = fopen(out, "wb");
+	if (!fp) {
+		perror(out);
+		return 1;
+	}
+
+	fwrite(&hdr, sizeof(hdr), 1, fp);
+	for (Uint32 i = 0; i < hdr.count; i++)
+		fwrite(&img[i].entry, sizeof(PackEntry), 1, fp);
+	for (Uint32 i = 0; i < hdr.count; i++) {
+		static const char zero[PACK_ALIGN];
+
+		fwrite(zero, img[i].entry.offset - ftell(fp), 1, fp);
+		fwrite(img[i].data, img[i].entry.size, 1, fp);
+	}
+
+	if (ferror(fp) || fclose(fp)) {
+		perror(out);
+		remove(out);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Infix Demo — Pack of pre-decoded images
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Decoding the PNGs at every start is a noticeable part of the time to
+ * first frame on a Raspberry Pi.  mkpack does it once at build time
+ * instead, converts every image to the pixel format the demo wants,
+ * and writes them all to one pack that is embedded in the binary.  At
+ * runtime an image is then just a surface pointing into the pack, or,
+ * if the pack was built with LZ4, one decompression into a surface.
+ */
+
+#include <string.h>
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
+#include "pack.h"
+
+static const PackEntry *pack_find(const void *pack, size_t len, const char *name)
+{
+	const PackHeader *hdr = pack;
+	const PackEntry *entry;
+
+	if (len < sizeof(*hdr) || memcmp(hdr->magic, PACK_MAGIC, 4) ||
+	    hdr->version != PACK_VERSION) {
+		SDL_SetError("Not an image pack");
+		return NULL;
+	}
+	if (hdr->count > (len - sizeof(*hdr)) / sizeof(*entry)) {
+		SDL_SetError("Truncated image pack");
+		return NULL;
+	}
+
+	entry = (const PackEntry *)(hdr + 1);
+	for (Uint32 i = 0; i < hdr->count; i++, entry++) {
+		if (strncmp(entry->name, name, PACK_NAME))
+			continue;
+
+		if (entry->offset > len || entry->size > len - entry->offset ||
+		    entry->pitch < entry->w * 4 || entry->h > SDL_MAX_SINT32 / entry->pitch) {
+			SDL_SetError("Corrupt image %s in pack", name);
+			return NULL;
+		}
+
+		return entry;
+	}
+
+	SDL_SetError("No image %s in pack", name);
+	return NULL;
+}
+
+SDL_Surface *pack_surface(const void *pack, size_t len, const char *name)
+{
+	const PackEntry *entry = pack_find(pack, len, name);
+	const char *data;
+
+	if (!entry)
+		return NULL;
+
+	data = (const char *)pack + entry->offset;
+	if (entry->size == entry->pitch * entry->h) {
+		/* Read-only use only, the pixels are in the pack */
+		return SDL_CreateRGBSurfaceWithFormatFrom((void *)data, entry->w, entry->h, 32,
+							  entry->pitch, entry->format);
+	}
+
+#ifdef HAVE_LZ4
+	SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, entry->w, entry->h, 32, entry->format);
+	if (!surface)
+		return NULL;
+
+	if (surface->pitch != (int)entry->pitch ||
+	    LZ4_decompress_safe(data, surface->pixels, entry->size,
+				entry->pitch * entry->h) != (int)(entry->pitch * entry->h)) {
+		SDL_FreeSurface(surface);
+		SDL_SetError("Corrupt image %s in pack", name);
+		return NULL;
+	}
+
+	return surface;
+#else
+	SDL_SetError("Image %s in pack is compressed, rebuild with LZ4=1", name);
+	return NULL;
+#endif
+}
@@ -0,0 +1,44 @@
+/*
+ * Infix Demo — Pack of pre-decoded images
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef PACK_H
+#define PACK_H
+
+#include <SDL2/SDL.h>
+
+#define PACK_MAGIC   "IXPK"
+#define PACK_VERSION 1
+#define PACK_NAME    16        /* Longest image name, including NUL */
+#define PACK_ALIGN   16        /* Of pixel data, from the start of the pack */
+
+/*
+ * A pack is this header, count entries, and the pixel data of each
+ * image.  Everything is in the byte order of the machine that built
+ * it, which is also the one it runs on.
+ */
+typedef struct {
+	char   magic[4];
+	Uint32 version;
+	Uint32 count;
+	Uint32 reserved;
+} PackHeader;
+
+typedef struct {
+	char   name[PACK_NAME];  /* File name without .png, e.g. "jack" */
+	Uint32 format;           /* SDL_PIXELFORMAT_*, 32 bits per pixel */
+	Uint32 w, h, pitch;
+	Uint32 offset;           /* Of the pixel data */
+	Uint32 size;             /* Stored, LZ4 compressed if less than pitch * h */
+} PackEntry;
+
+/*
+ * Surface for the named image in a pack, NULL if it is missing.  When
+ * stored uncompressed the surface uses the pixels in the pack, which
+ * must then outlive it and be suitably aligned, nothing is copied.
+ */
+SDL_Surface *pack_surface(const void *pack, size_t len, const char *name);
+
+#endif /* PACK_H */
@@ -0,0 +1,178 @@
+/*
+ * Infix Demo — Persistent worker pool for per-pixel effects
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Workers sleep on a condition variable between frames.  Each pool_for()
+ * call publishes one job, wakes everyone, and the caller then claims bands
+ * of rows alongside the workers until the frame is done.  Bands are handed
+ * out from an atomic cursor so uneven rows (e.g. the tunnel center) don't
+ * leave cores idle.
+ */
+
+#include <SDL2/SDL.h>
+#include "pool.h"
+
+/* Smallest band worth handing to a thread, in rows */
+#define POOL_MIN_BAND 4
+
+static struct {
+	SDL_Thread  *thread[POOL_MAX_THREADS];
+	int          nthreads;     /* Including the caller */
+	SDL_mutex   *lock;
+	SDL_cond    *wake;         /* Signaled when a new job is posted */
+	SDL_cond    *done;         /* Signaled when the last worker finishes */
+	unsigned int generation;   /* Bumped for every job */
+	int          busy;         /* Workers still running current job */
+	int          quit;
+
+	/* Current job */
+	pool_fn      fn;
+	void        *arg;
+	int          last;
+	int          band;
+	SDL_atomic_t next;         /* Next unclaimed row */
+} pool;
+
+static void run_bands(void)
+{
+	int y0;
+
+	while ((y0 = SDL_AtomicAdd(&pool.next, pool.band)) < pool.last) {
+		int y1 = y0 + pool.band;
+
+		if (y1 > pool.last)
+			y1 = pool.last;
+		pool.fn(pool.arg, y0, y1);
+	}
+}
+
+static int worker(void *unused)
+{
+	unsigned int seen = 0;
+
+	(void)unused;
+
+	SDL_LockMutex(pool.lock);
+	for (;;) {
+		while (pool.generation == seen && !pool.quit)
+			SDL_CondWait(pool.wake, pool.lock);
+		if (pool.quit)
+			break;
+
+		seen = pool.generation;
+		SDL_UnlockMutex(pool.lock);
+
+		run_bands();
+
+		SDL_LockMutex(pool.lock);
+		if (--pool.busy == 0)
+			SDL_CondSignal(pool.done);
+	}
+	SDL_UnlockMutex(pool.lock);
+
+	return 0;
+}
+
+int pool_init(int nthreads)
+{
+	if (nthreads <= 0)
+		nthreads = SDL_GetCPUCount();
+	if (nthreads > POOL_MAX_THREADS)
+		nthreads = POOL_MAX_THREADS;
+	if (nthreads < 1)
+		nthreads = 1;
+
+	pool.nthreads = 1;
+	if (nthreads == 1)
+		return 0;
+
+	pool.lock = SDL_CreateMutex();
+	pool.wake = SDL_CreateCond();
+	pool.done = SDL_CreateCond();
+	if (!pool.lock || !pool.wake || !pool.done) {
+		pool_exit();
+		return -1;
+	}
+
+	for (int i = 0; i < nthreads - 1; i++) {
+		pool.thread[i] = SDL_CreateThread(worker, "render", NULL);
+		if (!pool.thread[i])
+			break;
+		pool.nthreads++;
+	}
+
+	return 0;
+}
+
+void pool_for(int first, int last, pool_fn fn, void *arg)
+{
+	int rows = last - first;
+
+	if (rows <= 0)
+		return;
+
+	/* Not worth waking anyone up for */
+	if (pool.nthreads == 1 || rows < POOL_MIN_BAND * 2) {
+		fn(arg, first, last);
+		return;
+	}
+
+	/* Aim for ~4 bands per thread to balance uneven rows */
+	int band = rows / (pool.nthreads * 4);
+	if (band < POOL_MIN_BAND)
+		band = POOL_MIN_BAND;
+
+	SDL_LockMutex(pool.lock);
+	pool.fn   = fn;
+	pool.arg  = arg;
+	pool.last = last;
+	pool.band = band;
+	SDL_AtomicSet(&pool.next, first);
+	pool.busy = pool.nthreads - 1;
+	pool.generation++;
+	SDL_CondBroadcast(pool.wake);
+	SDL_UnlockMutex(pool.lock);
+
+	run_bands();
+
+	SDL_LockMutex(pool.lock);
+	while (pool.busy > 0)
+		SDL_CondWait(pool.done, pool.lock);
+	SDL_UnlockMutex(pool.lock);
+}
+
+int pool_threads(void)
+{
+	return pool.nthreads ? pool.nthreads : 1;
+}
+
+void pool_exit(void)
+{
+	if (pool.lock) {
+		SDL_LockMutex(pool.lock);
+		pool.quit = 1;
+		SDL_CondBroadcast(pool.wake);
+		SDL_UnlockMutex(pool.lock);
+	}
+
+	for (int i = 0; i < POOL_MAX_THREADS; i++) {
+		if (pool.thread[i]) {
+			SDL_WaitThread(pool.thread[i], NULL);
+			pool.thread[i] = NULL;
+		}
+	}
+
+	if (pool.done)
+		SDL_DestroyCond(pool.done);
+	if (pool.wake)
+		SDL_DestroyCond(pool.wake);
+	if (pool.lock)
+		SDL_DestroyMutex(pool.lock);
+
+	pool.done = pool.wake = NULL;
+	pool.lock = NULL;
+	pool.nthreads = 1;
+	pool.quit = 0;
+}
@@ -0,0 +1,27 @@
+/*
+ * Infix Demo — Persistent worker pool for per-pixel effects
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef POOL_H
+#define POOL_H
+
+#define POOL_MAX_THREADS 32
+
+/* Render rows [y0, y1) of a frame, called concurrently from all threads */
+typedef void (*pool_fn)(void *arg, int y0, int y1);
+
+/* Start nthreads - 1 workers (caller is the last), 0 = online CPUs */
+int  pool_init(int nthreads);
+
+/* Split rows [first, last) into bands and run fn on them in parallel */
+void pool_for(int first, int last, pool_fn fn, void *arg);
+
+/* Number of threads sharing the work, including the caller */
+int  pool_threads(void);
+
+/* Stop and join all workers */
+void pool_exit(void);
+
+#endif /* POOL_H */
@@ -0,0 +1,395 @@
+/*
+ * Infix Demo — Scroll text with embedded control codes
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * The scroll text is never copied or expanded as a whole.  The file is
+ * mapped read-only and laid out a chunk at a time, just ahead of what
+ * is on screen: control codes are stripped and parsed, every character
+ * gets its pixel position from the glyph atlas, and {SKIP:n} becomes a
+ * gap in those positions.  Chunks that have scrolled out of view are
+ * dropped, so memory use is the same for a one-liner and a 500 kB file
+ * of sponsor greetings.  At the end of the text, layout continues from
+ * the start again, a lap further to the right.
+ *
+ * Lines from a live feed are laid out next, ahead of the rest of the
+ * text, whenever one is waiting.  Chunks end at the first space after
+ * one screen width, so new lines scroll in within a screen or so.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "scroll.h"
+
+#define SCROLL_CHUNK    4096   /* Source bytes per chunk */
+#define SCROLL_CODE_MAX 64     /* Longest control code, including '}' */
+
+static ScrollText *scroll_alloc(int screen_w)
+{
+	ScrollText *st = calloc(1, sizeof(*st));
+
+	if (st)
+		st->screen_w = screen_w;
+
+	return st;
+}
+
+ScrollText *scroll_open(const char *path, int screen_w)
+{
+	ScrollText *st;
+	struct stat sb;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	st = scroll_alloc(screen_w);
+	if (!st)
+		goto fail;
+
+	if (fstat(fd, &sb) || !S_ISREG(sb.st_mode))
+		goto fail;
+
+	/* An empty file is an empty scroller, but mmap() refuses zero bytes */
+	if (sb.st_size > 0) {
+		void *map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (map == MAP_FAILED)
+			goto fail;
+		madvise(map, sb.st_size, MADV_SEQUENTIAL);
+
+		st->src = map;
+		st->len = sb.st_size;
+		st->mapped = 1;
+	}
+	close(fd);
+
+	return st;
+fail:
+	free(st);
+	close(fd);
+
+	return NULL;
+}
+
+ScrollText *scroll_from_string(const char *text, int screen_w)
+{
+	ScrollText *st = scroll_alloc(screen_w);
+
+	if (!st)
+		return NULL;
+
+	st->src = strdup(text);
+	if (!st->src) {
+		free(st);
+		return NULL;
+	}
+	st->len = strlen(text);
+
+	return st;
+}
+
+static void chunk_free(ScrollChunk *chunk)
+{
+	free(chunk->text);
+	free(chunk->adv);
+	free(chunk->code);
+}
+
+void scroll_close(ScrollText *st)
+{
+	if (!st)
+		return;
+
+	for (int i = 0; i < st->num_chunks; i++)
+		chunk_free(&st->chunk[i]);
+	free(st->chunk);
+
+	if (st->mapped)
+		munmap((void *)st->src, st->len);
+	else
+		free((void *)st->src);
+	free(st);
+}
+
+/* Parse one command, without braces, returns 0 if it is not a valid code */
+static int parse_code(const char *cmd, ControlCode *cc)
+{
+	char *endptr;
+
+	if (strncmp(cmd, "PAUSE:", 6) == 0) {
+		cc->type = CC_PAUSE;
+		cc->pause = strtof(cmd + 6, &endptr);
+		return endptr != cmd + 6 && cc->pause > 0;
+	}
+	if (strncmp(cmd, "SPEED:", 6) == 0) {
+		cc->type = CC_SPEED;
+		cc->speed = strtof(cmd + 6, &endptr);
+		return endptr != cmd + 6 && cc->speed >= 0;
+	}
+	if (strncmp(cmd, "STYLE:", 6) == 0) {
+		cc->type = CC_STYLE;
+		if (strcmp(cmd + 6, "wave") == 0)
+			cc->style = SCROLL_SINE_WAVE;
+		else if (strcmp(cmd + 6, "roller") == 0)
+			cc->style = SCROLL_ROLLER_3D;
+		else if (strcmp(cmd + 6, "classic") == 0)
+			cc->style = SCROLL_CLASSIC;
+		else if (strcmp(cmd + 6, "bounce") == 0)
+			cc->style = SCROLL_BOUNCE;
+		else
+			return 0;
+		return 1;
+	}
+	if (strncmp(cmd, "COLOR:", 6) == 0) {
+		int r, g, b;
+
+		cc->type = CC_COLOR;
+		if (sscanf(cmd + 6, "%d,%d,%d", &r, &g, &b) != 3)
+			return 0;
+		cc->rgb[0] = r;
+		cc->rgb[1] = g;
+		cc->rgb[2] = b;
+		return 1;
+	}
+
+	return 0;
+}
+
+static int add_code(ScrollChunk *chunk, const ControlCode *cc, int *max)
+{
+	if (chunk->num_codes == *max) {
+		int n = *max ? *max * 2 : 8;
+		ControlCode *code = realloc(chunk->code, n * sizeof(ControlCode));
+
+		if (!code)
+			return -1;
+		chunk->code = code;
+		*max = n;
+	}
+	chunk->code[chunk->num_codes++] = *cc;
+
+	return 0;
+}
+
+/*
+ * Lay out the next SCROLL_CHUNK bytes of source, or up to the first
+ * space after a screen width.  A control code that starts inside the
+ * chunk is finished even if it crosses the end, so codes are never
+ * split.  Returns 0 when there is nothing to lay out.
+ */
+static int parse_chunk(ScrollText *st, const GlyphAtlas *atlas, ScrollChunk *chunk)
+{
+	const char *src;
+	size_t len, *pos, end;
+	int w = 0, max_codes = 0;
+
+	if (!st->seg && st->feed)
+		st->seg = feed_peek(st->feed, &st->seg_len);
+
+	if (st->seg) {
+		src = st->seg;
+		len = st->seg_len;
+		pos = &st->seg_pos;
+	} else {
+		if (!st->len)
+			return 0;
+
+		if (st->pos >= st->len) {
+			/* Nothing visible in a whole lap, don't spin forever */
+			if (st->x <= st->lap_x)
+				return 0;
+
+			st->pos = 0;
+			st->index = 0;
+			st->prev = 0;
+			st->lap_x = st->x;
+		}
+
+		src = st->src;
+		len = st->len;
+		pos = &st->pos;
+	}
+
+	end = *pos + SCROLL_CHUNK;
+	if (end > len)
+		end = len;
+
+	memset(chunk, 0, sizeof(*chunk));
+	chunk->x = st->x;
+	chunk->index = st->index;
+	chunk->text = malloc(end - *pos);
+	chunk->adv = malloc((end - *pos + 1) * sizeof(int));
+	if (!chunk->text || !chunk->adv)
+		goto fail;
+
+	while (*pos < end) {
+		const char *p = src + *pos;
+		unsigned char ch = *p;
+
+		if (ch == '{') {
+			size_t n = len - *pos - 1;
+			const char *close;
+
+			if (n > SCROLL_CODE_MAX)
+				n = SCROLL_CODE_MAX;
+
+			close = memchr(p + 1, '}', n);
+			if (close) {
+				char cmd[SCROLL_CODE_MAX] = { 0 };
+				ControlCode cc;
+
+				*pos += close - p + 1;
+				if (close == p + 1)
+					continue;
+				memcpy(cmd, p + 1, close - p - 1);
+
+				/* SKIP only moves the text along, nothing to trigger */
+				if (strncmp(cmd, "SKIP:", 5) == 0) {
+					int spaces = (int)(atof(cmd + 5) * (st->screen_w / 35.0f));
+
+					if (spaces > 0)
+						w += spaces * atlas_advance(atlas, ' ');
+					st->prev = 0;
+					continue;
+				}
+
+				if (parse_code(cmd, &cc)) {
+					cc.x = chunk->x + w;
+#ifdef DEBUG_CONTROL_CODES
+					printf("Control code at pixel %.1f, type %d\n", cc.x, cc.type);
+#endif
+					if (add_code(chunk, &cc, &max_codes))
+						goto fail;
+				}
+				continue;
+			}
+		}
+
+		if (ch == '\n' || ch == '\r')
+			ch = ' ';
+
+		if (st->prev)
+			w += atlas_kerning(atlas, st->prev, ch);
+		chunk->adv[chunk->len] = w;
+		chunk->text[chunk->len++] = ch;
+		w += atlas_advance(atlas, ch);
+
+		st->prev = ch;
+		st->index++;
+		(*pos)++;
+
+		if (ch == ' ' && w >= st->screen_w)
+			break;
+	}
+	chunk->adv[chunk->len] = w;
+	st->x += w;
+
+	if (st->seg && st->seg_pos >= st->seg_len) {
+		feed_pop(st->feed);
+		st->seg = NULL;
+		st->seg_pos = 0;
+	}
+
+	return 1;
+fail:
+	chunk_free(chunk);
+
+	return -1;
+}
+
+static double chunk_end(const ScrollChunk *chunk)
+{
+	return chunk->x + chunk->adv[chunk->len];
+}
+
+/* Move the control code cursor past chunks with nothing left to trigger */
+static void skip_triggered(ScrollText *st)
+{
+	while (st->next_chunk < st->num_chunks &&
+	       st->next_code >= st->chunk[st->next_chunk].num_codes) {
+		st->next_chunk++;
+		st->next_code = 0;
+	}
+}
+
+int scroll_update(ScrollText *st, const GlyphAtlas *atlas, double left, double right)
+{
+	int drop = 0;
+
+	/* Chunks out of view, with all their codes triggered, are done */
+	skip_triggered(st);
+	while (drop < st->next_chunk && chunk_end(&st->chunk[drop]) < left)
+		chunk_free(&st->chunk[drop++]);
+	if (drop) {
+		st->num_chunks -= drop;
+		st->next_chunk -= drop;
+		memmove(st->chunk, st->chunk + drop, st->num_chunks * sizeof(ScrollChunk));
+	}
+
+	/* After running dry, new text scrolls in from the right edge */
+	if (st->dry && st->x < right)
+		st->x = right;
+
+	while (!st->num_chunks || chunk_end(&st->chunk[st->num_chunks - 1]) < right) {
+		int rc;
+
+		if (st->num_chunks == st->max_chunks) {
+			int n = st->max_chunks ? st->max_chunks * 2 : 8;
+			ScrollChunk *chunk = realloc(st->chunk, n * sizeof(ScrollChunk));
+
+			if (!chunk)
+				return -1;
+			st->chunk = chunk;
+			st->max_chunks = n;
+		}
+
+		rc = parse_chunk(st, atlas, &st->chunk[st->num_chunks]);
+		st->dry = rc == 0;
+		if (rc <= 0)
+			return rc;
+		st->num_chunks++;
+	}
+
+	return 0;
+}
+
+const ControlCode *scroll_next_code(ScrollText *st, double x)
+{
+	const ControlCode *cc;
+
+	skip_triggered(st);
+	if (st->next_chunk >= st->num_chunks)
+		return NULL;
+
+	cc = &st->chunk[st->next_chunk].code[st->next_code];
+	if (cc->x > x)
+		return NULL;
+	st->next_code++;
+
+	return cc;
+}
+
+int scroll_chunk_find(const ScrollChunk *chunk, double x)
+{
+	int lo = 0, hi = chunk->len;
+
+	x -= chunk->x;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+
+		if (chunk->adv[mid] < x)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
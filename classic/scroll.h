@@ -0,0 +1,95 @@
+/*
+ * Infix Demo — Scroll text with embedded control codes
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef SCROLL_H
+#define SCROLL_H
+
+#include <stddef.h>
+#include "atlas.h"
+#include "feed.h"
+
+typedef enum {
+	SCROLL_NONE,
+	SCROLL_SINE_WAVE,
+	SCROLL_CLASSIC,
+	SCROLL_ROLLER_3D,
+	SCROLL_BOUNCE
+} ScrollStyle;
+
+/* Control codes embedded in the scroll text, e.g. {PAUSE:2} */
+typedef enum {
+	CC_PAUSE,
+	CC_SPEED,
+	CC_STYLE,
+	CC_COLOR
+} ControlType;
+
+typedef struct {
+	double x;              /* Pixel position in the text */
+	ControlType type;
+	union {
+		float pause;       /* Seconds */
+		float speed;       /* Pixels per second */
+		ScrollStyle style;
+		Uint8 rgb[3];
+	};
+} ControlCode;
+
+/*
+ * A laid out piece of the text.  Pixel positions grow without bound,
+ * each lap of the text continues where the previous one ended.  They
+ * are doubles, a float can no longer tell pixels apart after 2^24, or
+ * about a day of scrolling, a double lasts for millennia.
+ */
+typedef struct {
+	double       x;        /* Pixel position of the first character */
+	int          index;    /* Character index of the first character in its lap */
+	int          len;
+	char        *text;     /* Control codes stripped */
+	int         *adv;      /* Start of character i relative to x, adv[len] is the width */
+	ControlCode *code;     /* In text order, which is also pixel order */
+	int          num_codes;
+} ScrollChunk;
+
+typedef struct {
+	const char  *src;      /* Source text, read-only, usually mmap()ed */
+	size_t       len;
+	int          mapped;
+	int          screen_w; /* For {SKIP:screens}, and chunk width */
+	Feed        *feed;     /* Optional live text, laid out as soon as it arrives */
+
+	size_t       pos;      /* Parser position in src */
+	double       x;        /* Pixel position of the next character */
+	double       lap_x;    /* Pixel position where this lap started */
+	int          index;
+	unsigned char prev;    /* Previous character, for kerning */
+	int          dry;      /* Ran out of text, waiting for the feed */
+
+	const char  *seg;      /* Feed line being laid out */
+	size_t       seg_len;
+	size_t       seg_pos;
+
+	ScrollChunk *chunk;    /* Laid out chunks, oldest first */
+	int          num_chunks;
+	int          max_chunks;
+	int          next_chunk, next_code; /* First control code not yet triggered */
+} ScrollText;
+
+/* Map a file, or copy a string, {SKIP:1} scrolls one screen_w */
+ScrollText *scroll_open(const char *path, int screen_w);
+ScrollText *scroll_from_string(const char *text, int screen_w);
+void        scroll_close(ScrollText *st);
+
+/* Lay out text up to pixel position right, drop what is left of left */
+int         scroll_update(ScrollText *st, const GlyphAtlas *atlas, double left, double right);
+
+/* Next control code at or before pixel position x, or NULL */
+const ControlCode *scroll_next_code(ScrollText *st, double x);
+
+/* First character of a chunk starting at or after pixel position x */
+int         scroll_chunk_find(const ScrollChunk *chunk, double x);
+
+#endif /* SCROLL_H */
@@ -0,0 +1,206 @@
+/*
+ * Infix Demo — Per-scene frame time statistics and performance HUD
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * The latest STATS_FRAMES frames of every scene are kept in a ring, so
+ * the numbers always describe how a scene runs now, not an average
+ * over an hour of kiosk duty.  Percentiles are only worked out when a
+ * report is asked for, recording a frame is three stores.
+ *
+ *     kill -USR1 $(pidof demo)
+ */
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stats.h"
+
+#define HUD_FRAMES 240         /* Frames in the graph, one pixel each */
+#define HUD_HEIGHT 60          /* Graph height, in pixels */
+#define HUD_MS_PX  2           /* Pixels per millisecond */
+#define HUD_SCALE  3           /* Of the 48 pt font, for 16 pixel text */
+
+static struct {
+	const char *const    *name;
+	int                   report;
+	volatile sig_atomic_t signaled;
+
+	struct {
+		FrameTimes    ring[STATS_FRAMES];
+		unsigned int  count;   /* Frames ever recorded */
+	} scene[STATS_SCENES];
+} stats;
+
+static void on_usr1(int signo)
+{
+	(void)signo;
+	stats.signaled = 1;
+}
+
+void stats_init(const char *const name[STATS_SCENES], int report)
+{
+	stats.name = name;
+	stats.report = report;
+
+	if (report) {
+		struct sigaction sa = { .sa_handler = on_usr1, .sa_flags = SA_RESTART };
+
+		sigemptyset(&sa.sa_mask);
+		sigaction(SIGUSR1, &sa, NULL);
+	}
+}
+
+void stats_exit(void)
+{
+	if (stats.report)
+		stats_report(stdout);
+}
+
+void stats_add(int scene, const FrameTimes *ft)
+{
+	if (scene < 0 || scene >= STATS_SCENES)
+		return;
+
+	stats.scene[scene].ring[stats.scene[scene].count++ % STATS_FRAMES] = *ft;
+}
+
+static int cmp_float(const void *a, const void *b)
+{
+	float x = *(const float *)a, y = *(const float *)b;
+
+	return (x > y) - (x < y);
+}
+
+void stats_sort(float *v, int n)
+{
+	qsort(v, n, sizeof(float), cmp_float);
+}
+
+float stats_percentile(const float *v, int n, int p)
+{
+	int rank = (p * n + 99) / 100;
+
+	return v[rank > 0 ? rank - 1 : 0];
+}
+
+void stats_report(FILE *fp)
+{
+	static const char *metric[] = { "render", "present", "total" };
+	float v[STATS_FRAMES];
+
+	fprintf(fp, "%-18s %6s %-8s %7s %7s %7s %7s\n",
+		"Scene", "frames", "ms", "p50", "p95", "p99", "max");
+
+	for (int s = 0; s < STATS_SCENES; s++) {
+		int n = stats.scene[s].count < STATS_FRAMES ? (int)stats.scene[s].count : STATS_FRAMES;
+
+		if (!n)
+			continue;
+
+		for (int m = 0; m < 3; m++) {
+			for (int i = 0; i < n; i++) {
+				const FrameTimes *ft = &stats.scene[s].ring[i];
+
+				v[i] = m == 0 ? ft->render : m == 1 ? ft->present : ft->total;
+			}
+			stats_sort(v, n);
+
+			if (m)
+				fprintf(fp, "%-18s %6s ", "", "");
+			else
+				fprintf(fp, "%d %-16s %6d ", s, stats.name[s], n);
+			fprintf(fp, "%-8s %7.2f %7.2f %7.2f %7.2f\n", metric[m],
+				stats_percentile(v, n, 50), stats_percentile(v, n, 95),
+				stats_percentile(v, n, 99), v[n - 1]);
+		}
+	}
+	fflush(fp);
+}
+
+void stats_poll(void)
+{
+	if (!stats.signaled)
+		return;
+
+	stats.signaled = 0;
+	stats_report(stdout);
+}
+
+/* Text at a third of the atlas size, returns its width */
+static int hud_text(GlyphBatch *batch, const GlyphAtlas *atlas, const char *text,
+		    int x, int y, SDL_Color color)
+{
+	int x0 = x;
+
+	for (const char *p = text; *p; p++) {
+		unsigned char ch = *p;
+		const AtlasGlyph *g = atlas_glyph(atlas, GLYPH_PLAIN, ch);
+
+		if (g->valid) {
+			SDL_Rect dst = { x, y, g->src.w / HUD_SCALE, g->src.h / HUD_SCALE };
+
+			batch_quad(batch, atlas, g, &dst, color);
+		}
+		x += atlas_advance(atlas, ch) / HUD_SCALE;
+	}
+
+	return x - x0;
+}
+
+void stats_hud(SDL_Renderer *renderer, const GlyphAtlas *atlas, int scene, float budget, int x, int y)
+{
+	static GlyphBatch batch;
+	SDL_Color green = { 100, 255, 100, 255 };
+	SDL_Rect bar[HUD_FRAMES], bg;
+	int n = 0, avg = 0, w, line;
+	unsigned int count;
+	float sum = 0.0f;
+	char text[32];
+
+	if (scene < 0 || scene >= STATS_SCENES)
+		return;
+	count = stats.scene[scene].count;
+
+	/* Newest frame rightmost, fps from the last half second or so */
+	for (int i = 0; i < HUD_FRAMES && (unsigned int)i < count; i++) {
+		float ms = stats.scene[scene].ring[(count - 1 - i) % STATS_FRAMES].total;
+		int h = (int)(ms * HUD_MS_PX);
+
+		if (h > HUD_HEIGHT)
+			h = HUD_HEIGHT;
+		if (h < 1)
+			h = 1;
+		bar[n++] = (SDL_Rect){ x + 4 + HUD_FRAMES - 1 - i, y + 24 + HUD_HEIGHT - h, 1, h };
+		if (i < 30) {
+			sum += ms;
+			avg++;
+		}
+	}
+
+	if (sum > 0.0f)
+		snprintf(text, sizeof(text), "%.0f fps %.1f ms", 1000.0f * avg / sum, sum / avg);
+	else
+		snprintf(text, sizeof(text), "-- fps");
+	w = atlas ? hud_text(&batch, atlas, text, x + 4, y + 4, green) : 0;
+
+	bg = (SDL_Rect){ x, y, (w > HUD_FRAMES ? w : HUD_FRAMES) + 8, HUD_HEIGHT + 28 };
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	SDL_SetRenderDrawColor(renderer, 0, 0, 0, 160);
+	SDL_RenderFillRect(renderer, &bg);
+
+	SDL_SetRenderDrawColor(renderer, green.r, green.g, green.b, 255);
+	SDL_RenderFillRects(renderer, bar, n);
+
+	/* The frame budget, at the top of the graph if it is higher */
+	line = (int)(budget * HUD_MS_PX);
+	if (line > HUD_HEIGHT)
+		line = HUD_HEIGHT;
+	line = y + 24 + HUD_HEIGHT - line;
+	SDL_SetRenderDrawColor(renderer, 255, 80, 80, 255);
+	SDL_RenderDrawLine(renderer, x + 4, line, x + 3 + HUD_FRAMES, line);
+
+	if (atlas)
+		batch_draw(&batch, renderer, atlas->tex);
+}
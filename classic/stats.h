@@ -0,0 +1,42 @@
+/*
+ * Infix Demo — Per-scene frame time statistics and performance HUD
+ * Copyright (c) 2025  Joachim Wiberg <troglobit@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+#include "atlas.h"
+
+#define STATS_SCENES 9
+#define STATS_FRAMES 1024      /* Latest frames kept per scene, power of two */
+
+/* Where the time of one frame went, in milliseconds */
+typedef struct {
+	float render;          /* CPU time until SDL_RenderPresent() */
+	float present;         /* Blocked in SDL_RenderPresent() */
+	float total;           /* Start to start, including pacing */
+} FrameTimes;
+
+/* Scene names for the report, with report set also print on SIGUSR1 and exit */
+void stats_init(const char *const name[STATS_SCENES], int report);
+void stats_exit(void);
+
+void stats_add(int scene, const FrameTimes *ft);
+
+/* Sort n frame times, then get their nearest-rank percentile p */
+void stats_sort(float *v, int n);
+float stats_percentile(const float *v, int n, int p);
+
+/* Print percentiles for all scenes seen so far */
+void stats_report(FILE *fp);
+
+/* Call once per frame, reports if SIGUSR1 has arrived since last time */
+void stats_poll(void);
+
+/* Overlay fps and a graph of recent frame times of scene at (x, y), budget in ms */
+void stats_hud(SDL_Renderer *renderer, const GlyphAtlas *atlas, int scene, float budget, int x, int y);
+
+#endif /* STATS_H */